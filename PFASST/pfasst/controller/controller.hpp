@@ -8,6 +8,7 @@ using std::shared_ptr;
 #include "pfasst/globals.hpp"
 #include "pfasst/comm/communicator.hpp"
 #include "pfasst/controller/status.hpp"
+#include "pfasst/node_pool.hpp"
 
 
 namespace pfasst
@@ -45,6 +46,8 @@ namespace pfasst
       shared_ptr<transfer_t>      _transfer;
       //! Status object.
       shared_ptr<Status<time_t>>  _status;
+      //! Threads for per-node assembly, shared with all Sweepers and the Transfer Operator.
+      shared_ptr<NodePool>        _thread_pool;
       //! Flag to indicate readiness for execution.
       bool                        _ready;
       //! Name of the Controller in the logs.
@@ -91,6 +94,15 @@ namespace pfasst
       //! Read-only version of `status()`.
       virtual const shared_ptr<Status<typename TransferT::traits::fine_time_t>>  get_status() const;
 
+      /**
+       * Accessor for the thread pool handed to Sweepers and Transfer Operator in `setup()`.
+       *
+       * The pool lives as long as the Controller and is reused for all time steps.
+       */
+      virtual       shared_ptr<NodePool>& thread_pool();
+      //! Read-only version of `thread_pool()`.
+      virtual const shared_ptr<NodePool>  get_thread_pool() const;
+
       /**
        * Number of levels/sweeper currently configured for this Controller.
        *
@@ -151,6 +163,9 @@ namespace pfasst
       //! @{
       /**
        * Configures the Controller according to given command line arguments.
+       *
+       * With `assembly_threads > 1` a thread pool for the per-node integrals, residuals and FAS
+       * corrections is created.
        */
       virtual void set_options();
       /**
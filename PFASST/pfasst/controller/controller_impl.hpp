@@ -16,6 +16,7 @@ namespace pfasst
   template<class TransferT, class CommT>
   Controller<TransferT, CommT>::Controller()
     :   _status(std::make_shared<Status<typename TransferT::traits::fine_time_t>>())
+      , _thread_pool(nullptr)
       , _ready(false)
       , _logger_id("CONTROL")
   {}
@@ -48,6 +49,20 @@ namespace pfasst
     return this->_status;
   }
 
+  template<class TransferT, class CommT>
+  shared_ptr<NodePool>&
+  Controller<TransferT, CommT>::thread_pool()
+  {
+    return this->_thread_pool;
+  }
+
+  template<class TransferT, class CommT>
+  const shared_ptr<NodePool>
+  Controller<TransferT, CommT>::get_thread_pool() const
+  {
+    return this->_thread_pool;
+  }
+
   template<class TransferT, class CommT>
   size_t
   Controller<TransferT, CommT>::get_num_levels() const
@@ -124,6 +139,7 @@ namespace pfasst
   /**
    * @note Sets the maximum number of iterations and time end point from the command line arguments
    *   or leaves set values unchanged if not given on the command line.
+   *   Without `assembly_threads` (or with `assembly_threads=1`) no thread pool is created.
    */
   template<class TransferT, class CommT>
   void
@@ -131,6 +147,14 @@ namespace pfasst
   {
     this->status()->max_iterations() = config::get_value<size_t>("num_iters", this->get_status()->get_max_iterations());
     this->status()->t_end() = config::get_value<typename TransferT::traits::fine_time_t>("t_end", this->get_status()->get_t_end());
+
+    const size_t assembly_threads = config::get_value<size_t>("assembly_threads", 1);
+    if (assembly_threads > 1) {
+      this->thread_pool() = std::make_shared<NodePool>(assembly_threads);
+    } else {
+      this->thread_pool() = nullptr;
+    }
+    ML_CVLOG(3, this->get_logger_id(), "  assembly threads: " << assembly_threads);
   }
 
   template<class TransferT, class CommT>
@@ -196,6 +220,10 @@ namespace pfasst
       "You sould define a maximum number of iterations to avoid endless runs."
       << " (" << this->get_status()->get_max_iterations() << ")");
 
+    if (this->get_transfer() != nullptr) {
+      this->get_transfer()->thread_pool() = this->get_thread_pool();
+    }
+
     this->ready() = true;
   }
 
@@ -97,6 +97,7 @@ namespace pfasst
     }
 
     this->get_sweeper()->status() = this->get_status();
+    this->get_sweeper()->thread_pool() = this->get_thread_pool();
     this->get_sweeper()->setup();
   }
 
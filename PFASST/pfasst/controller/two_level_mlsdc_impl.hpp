@@ -144,10 +144,12 @@ namespace pfasst
 
     ML_CVLOG(1, this->get_logger_id(), "setting up coarse level");
     this->get_coarse()->status() = this->get_status();
+    this->get_coarse()->thread_pool() = this->get_thread_pool();
     this->get_coarse()->setup();
 
     ML_CVLOG(1, this->get_logger_id(), "setting up fine level");
     this->get_fine()->status() = this->get_status();
+    this->get_fine()->thread_pool() = this->get_thread_pool();
     this->get_fine()->setup();
   }
 
@@ -9,6 +9,7 @@ using std::vector;
 
 #include "pfasst/globals.hpp"
 #include "pfasst/logging.hpp"
+#include "pfasst/node_pool.hpp"
 #include "pfasst/encap/traits.hpp"
 
 
@@ -81,6 +82,10 @@ namespace pfasst
      * @see pfasst::encap::mat_mul_vec()
      *  for a version not modifying any input data
      *
+     * @note The actual work is delegated to `mat_apply_kernel()` dispatched on
+     *   `EncapsulationTrait::tag_t`.
+     *   @p x and @p y must not share any Encapsulation.
+     *
      * @ingroup Encapsulation
      */
     template<
@@ -93,6 +98,49 @@ namespace pfasst
               const vector<shared_ptr<Encapsulation<EncapsulationTrait>>>& y,
               const bool zero_vec_x = true);
 
+    /**
+     * Row-parallel version of `mat_apply()`.
+     *
+     * The rows of @p matrix are distributed over the threads of @p pool, each running
+     * `mat_apply_kernel()` on its own entry of @p x.
+     * Without a pool this is the same as `mat_apply()`.
+     *
+     * @ingroup Encapsulation
+     */
+    template<
+      class EncapsulationTrait
+    >
+    void
+    mat_apply(vector<shared_ptr<Encapsulation<EncapsulationTrait>>>& x,
+              const typename EncapsulationTrait::time_type& a,
+              const Matrix<typename EncapsulationTrait::time_type>& matrix,
+              const vector<shared_ptr<Encapsulation<EncapsulationTrait>>>& y,
+              const bool zero_vec_x,
+              const shared_ptr<NodePool>& pool);
+
+    /**
+     * Generic kernel behind mat_apply().
+     *
+     * Applies the scaled matrix row by row through Encapsulation::scaled_add(), i.e. each of the
+     * entries of @p y is read once per row of @p matrix.
+     * Encapsulations with direct access to contiguous storage may provide an overload for their
+     * own tag type which is then picked up via argument dependent lookup.
+     *
+     * @see pfasst::encap::mat_apply()
+     *
+     * @ingroup Encapsulation
+     */
+    template<
+      class EncapsulationTrait
+    >
+    void
+    mat_apply_kernel(vector<shared_ptr<Encapsulation<EncapsulationTrait>>>& x,
+                     const typename EncapsulationTrait::time_t& a,
+                     const Matrix<typename EncapsulationTrait::time_t>& matrix,
+                     const vector<shared_ptr<Encapsulation<EncapsulationTrait>>>& y,
+                     const bool zero_vec_x,
+                     const encap_data_tag&);
+
     /**
      * Computes scaled matrix-vector product \\( aMx \\).
      *
@@ -38,6 +38,49 @@ namespace pfasst
         << "size of result vector (" << x.size()
         << ") does not match result of matrix-vector multiplication (" << mat.rows() << ")";
 
+      // dispatch on the tag type; specialized kernels are found via ADL
+      mat_apply_kernel(x, a, mat, y, zero_vec_x, typename EncapsulationTrait::tag_t());
+    }
+
+    template<class EncapsulationTrait>
+    void
+    mat_apply(vector<shared_ptr<Encapsulation<EncapsulationTrait>>>& x,
+              const typename EncapsulationTrait::time_t& a,
+              const Matrix<typename EncapsulationTrait::time_t>& mat,
+              const vector<shared_ptr<Encapsulation<EncapsulationTrait>>>& y,
+              const bool zero_vec_x,
+              const shared_ptr<NodePool>& pool)
+    {
+      if (!pool || x.size() < 2) {
+        mat_apply(x, a, mat, y, zero_vec_x);
+        return;
+      }
+
+      CLOG_IF(x.size() != (size_t)mat.rows(), WARNING, "ENCAP")
+        << "size of result vector (" << x.size()
+        << ") does not match result of matrix-vector multiplication (" << mat.rows() << ")";
+
+      const size_t rows = std::min(x.size(), (size_t)mat.rows());
+      pool->for_each(x.size(), [&](const size_t n) {
+        vector<shared_ptr<Encapsulation<EncapsulationTrait>>> xn(1, x[n]);
+        if (n < rows) {
+          const Matrix<typename EncapsulationTrait::time_t> row = mat.row(n);
+          mat_apply_kernel(xn, a, row, y, zero_vec_x, typename EncapsulationTrait::tag_t());
+        } else if (zero_vec_x) {
+          x[n]->zero();
+        }
+      });
+    }
+
+    template<class EncapsulationTrait>
+    void
+    mat_apply_kernel(vector<shared_ptr<Encapsulation<EncapsulationTrait>>>& x,
+                     const typename EncapsulationTrait::time_t& a,
+                     const Matrix<typename EncapsulationTrait::time_t>& mat,
+                     const vector<shared_ptr<Encapsulation<EncapsulationTrait>>>& y,
+                     const bool zero_vec_x,
+                     const encap_data_tag&)
+    {
       if (zero_vec_x) {
         std::for_each(x.begin(), x.end(),
                  [](shared_ptr<Encapsulation<EncapsulationTrait>> xi) {
@@ -67,12 +110,11 @@ namespace pfasst
       // initialize result vector of encaps
       vector<shared_ptr<Encapsulation<EncapsulationTrait>>> result(rows);
       for(auto& ri : result) {
-        ri = std::make_shared<Encapsulation<EncapsulationTrait>>();
-        ri->data() = x[0]->get_data();
-        ri->zero();
+        ri = std::make_shared<Encapsulation<EncapsulationTrait>>(x[0]->get_data());
       }
 
-      mat_apply(result, a, mat, x, false);
+      // zeroing is left to the kernel, which may overwrite instead of accumulate
+      mat_apply(result, a, mat, x, true);
       return result;
     }
 
@@ -85,6 +85,8 @@ const string OUT::reset = "\033[0m";
 #define ELPP_NO_DEFAULT_LOG_FILE
 // enable passing `--logging-flags` via command line
 #define ELPP_LOGGING_FLAGS_FROM_ARG
+// tasks running on a NodePool may log as well
+#define ELPP_THREAD_SAFE
 
 #ifndef NDEBUG
   #define ELPP_DEBUG_ASSERT_FAILURE
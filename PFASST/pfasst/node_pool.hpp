@@ -0,0 +1,78 @@
+#ifndef _PFASST__NODE_POOL_HPP_
+#define _PFASST__NODE_POOL_HPP_
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+using std::shared_ptr;
+using std::vector;
+
+
+namespace pfasst
+{
+  /**
+   * Fixed set of worker threads running independent per-node tasks.
+   *
+   * The threads are started once and sleep between calls to `for_each()`.
+   * The calling thread takes part in the work, i.e. a pool of size @f$ p @f$ starts @f$ p - 1 @f$
+   * threads.
+   *
+   * Used by the sweepers for node-parallel implicit solves and, owned by the Controller, for the
+   * per-node integrals, residuals and FAS corrections.
+   */
+  class NodePool
+  {
+    protected:
+      vector<std::thread>                    _workers;
+      std::mutex                             _mutex;
+      std::condition_variable                _work_available;
+      std::condition_variable                _work_done;
+
+      std::function<void(const size_t)>      _task;
+      size_t                                 _next;
+      size_t                                 _end;
+      size_t                                 _pending;
+      size_t                                 _generation;
+      bool                                   _stop;
+      std::exception_ptr                     _error;
+
+      //! Runs tasks of the current batch until none is left; expects @p lock to be held.
+      void drain(std::unique_lock<std::mutex>& lock);
+      void work();
+
+    public:
+      //! @param[in] num_threads  number of threads working on a batch, including the calling one
+      explicit NodePool(const size_t num_threads);
+      NodePool(const NodePool& other) = delete;
+      NodePool(NodePool&& other) = delete;
+      virtual ~NodePool();
+      NodePool& operator=(const NodePool& other) = delete;
+      NodePool& operator=(NodePool&& other) = delete;
+
+      virtual size_t size() const;
+
+      /**
+       * Runs @p task for `0, ..., num_tasks - 1` and returns once all of them are done.
+       *
+       * Tasks run concurrently and in no particular order.
+       * The first exception thrown by a task is rethrown after all other tasks have finished.
+       */
+      virtual void for_each(const size_t num_tasks, const std::function<void(const size_t)>& task);
+  };
+
+  /**
+   * Runs @p task for `0, ..., num_tasks - 1` on @p pool.
+   *
+   * Without a pool the tasks run in order on the calling thread.
+   */
+  inline void parallel_for(const shared_ptr<NodePool>& pool, const size_t num_tasks,
+                           const std::function<void(const size_t)>& task);
+}  // ::pfasst
+
+#include "pfasst/node_pool_impl.hpp"
+
+#endif  // _PFASST__NODE_POOL_HPP_
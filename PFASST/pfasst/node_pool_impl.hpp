@@ -0,0 +1,128 @@
+#include "pfasst/node_pool.hpp"
+
+#include <algorithm>
+
+
+namespace pfasst
+{
+  inline
+  NodePool::NodePool(const size_t num_threads)
+    :   _workers()
+      , _task()
+      , _next(0)
+      , _end(0)
+      , _pending(0)
+      , _generation(0)
+      , _stop(false)
+      , _error()
+  {
+    const size_t num_workers = std::max<size_t>(num_threads, 1) - 1;
+    this->_workers.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+      this->_workers.emplace_back(&NodePool::work, this);
+    }
+  }
+
+  inline
+  NodePool::~NodePool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->_mutex);
+      this->_stop = true;
+    }
+    this->_work_available.notify_all();
+    for (auto& worker : this->_workers) {
+      worker.join();
+    }
+  }
+
+  inline size_t
+  NodePool::size() const
+  {
+    return this->_workers.size() + 1;
+  }
+
+  inline void
+  NodePool::drain(std::unique_lock<std::mutex>& lock)
+  {
+    while (this->_next < this->_end) {
+      const size_t i = this->_next++;
+      lock.unlock();
+      try {
+        this->_task(i);
+      } catch (...) {
+        lock.lock();
+        if (!this->_error) {
+          this->_error = std::current_exception();
+        }
+        lock.unlock();
+      }
+      lock.lock();
+      if (--this->_pending == 0) {
+        this->_work_done.notify_all();
+      }
+    }
+  }
+
+  inline void
+  NodePool::work()
+  {
+    std::unique_lock<std::mutex> lock(this->_mutex);
+    size_t seen = this->_generation;
+    while (true) {
+      this->_work_available.wait(lock, [this, seen]() {
+        return this->_stop || this->_generation != seen;
+      });
+      if (this->_stop) {
+        return;
+      }
+      seen = this->_generation;
+      this->drain(lock);
+    }
+  }
+
+  inline void
+  NodePool::for_each(const size_t num_tasks, const std::function<void(const size_t)>& task)
+  {
+    if (num_tasks == 0) {
+      return;
+    }
+
+    if (this->_workers.empty() || num_tasks == 1) {
+      for (size_t i = 0; i < num_tasks; ++i) {
+        task(i);
+      }
+      return;
+    }
+
+    std::unique_lock<std::mutex> lock(this->_mutex);
+    this->_task = task;
+    this->_next = 0;
+    this->_end = num_tasks;
+    this->_pending = num_tasks;
+    this->_error = nullptr;
+    this->_generation++;
+    this->_work_available.notify_all();
+
+    this->drain(lock);
+    this->_work_done.wait(lock, [this]() { return this->_pending == 0; });
+
+    this->_task = nullptr;
+    if (this->_error) {
+      std::rethrow_exception(this->_error);
+    }
+  }
+
+  inline void
+  parallel_for(const shared_ptr<NodePool>& pool, const size_t num_tasks,
+               const std::function<void(const size_t)>& task)
+  {
+    if (pool) {
+      pool->for_each(num_tasks, task);
+    } else {
+      for (size_t i = 0; i < num_tasks; ++i) {
+        task(i);
+      }
+    }
+  }
+}  // ::pfasst
@@ -25,6 +25,22 @@ using std::vector;
 
 namespace pfasst
 {
+  /**
+   * Tag selecting the sweeper specialization for a number of quadrature nodes fixed at compile time.
+   *
+   * Passed as the `Enabled` template argument of a sweeper supporting it, e.g.
+   * `IMEX<SweeperTrait, FixedNodes<3>>`.
+   *
+   * @tparam NumNodes  number of quadrature nodes, not counting the initial value
+   *
+   * @ingroup Quadrature
+   */
+  template<size_t NumNodes>
+  struct FixedNodes
+  {
+    static constexpr size_t num_nodes = NumNodes;
+  };
+
   /**
    * @defgroup Quadrature Quadrature
    *   Quadrature rules provide the foundation for numerical integration.
@@ -73,6 +89,42 @@ namespace pfasst
       }
     }
 
+    /**
+     * Instantiates quadrature handler and dispatches on its number of nodes.
+     *
+     * Calls @p visitor as `visitor(quadrature, tag)` with `tag` being a null pointer to
+     * `FixedNodes<nnodes>` for 3, 4 or 5 nodes and a null `void*` for any other number, so a generic
+     * lambda gets the `Enabled` argument of the matching sweeper by
+     * `typename std::remove_pointer<decltype(tag)>::type`.
+     *
+     * @tparam precision numerical type of the nodes (e.g. `double`)
+     * @param[in] nnodes number of quadrature nodes
+     * @param[in] qtype type descriptor of the quadrature
+     * @param[in] visitor callable taking the quadrature and the tag; must return the same type for
+     *   all tags
+     * @returns what @p visitor returns
+     * @throws invalid_argument if @p qtype is not a valid quadrature type descriptor
+     *
+     * @ingroup Quadrature
+     */
+    template<typename precision, class Visitor>
+    auto quadrature_factory(const size_t nnodes, const QuadratureType qtype, Visitor&& visitor)
+      -> decltype(visitor(shared_ptr<IQuadrature<precision>>(), static_cast<void*>(nullptr)))
+    {
+      auto quadrature = quadrature_factory<precision>(nnodes, qtype);
+
+      switch (nnodes) {
+        case 3:
+          return visitor(quadrature, static_cast<FixedNodes<3>*>(nullptr));
+        case 4:
+          return visitor(quadrature, static_cast<FixedNodes<4>*>(nullptr));
+        case 5:
+          return visitor(quadrature, static_cast<FixedNodes<5>*>(nullptr));
+        default:
+          return visitor(quadrature, static_cast<void*>(nullptr));
+      }
+    }
+
     /**
      * Compute quadrature nodes for given quadrature type descriptor.
      *
@@ -7,6 +7,7 @@ using std::shared_ptr;
 using std::vector;
 
 #include "pfasst/sweeper/sweeper.hpp"
+#include "pfasst/sweeper/implicit_operator_cache.hpp"
 
 //#include "../../../src/finite_element_stuff/fe_manager_fp.hpp"
 
@@ -84,6 +85,14 @@ namespace pfasst
       //! Cache for the implicit function evaluations @f$ F_I(\vec{u}_n, t_n) @f$.
       vector<shared_ptr<typename traits::encap_t>> _impl_rhs;
       vector<shared_ptr<typename traits::encap_t>> _impl_rhs_restrict;
+      /**
+       * Cache for @f$ M \vec{u}_0 @f$ used by the sweeps and the residuals.
+       *
+       * Valid as long as `_M_u0_version` matches the version of the initial state, i.e. only recomputed
+       * after `initial_state()` was changed by `advance()`, the transfer or the communicator.
+       */
+      shared_ptr<typename traits::encap_t>         _M_u0;
+      size_t                                       _M_u0_version;
       
 
       //! Counter for total number of @f$ F_E(\vec{u},t) @f$ evaluations.
@@ -92,6 +101,15 @@ namespace pfasst
       size_t _num_impl_f_evals;
       //! Counter for total number of implicit solves.
       size_t _num_impl_solves;
+      /**
+       * Assembled implicit operators @f$ M + c A @f$ of this level, one per distinct coefficient.
+       *
+       * Uses sparse direct factorizations if UMFPack is available and the runtime parameter
+       * `impl_direct=1` is given; preconditioned CG otherwise.
+       * Sweepers reassembling @f$ M @f$ or @f$ A @f$ must clear it.
+       * Iterative solves recycle up to `impl_recycle` CG directions per operator.
+       */
+      ImplicitOperatorCache<MatrixType, VectorType> _impl_operators;
 
       //! @{
       /**
@@ -112,6 +130,12 @@ namespace pfasst
        * @copybrief Sweeper::initialize()
        */
       virtual void initialize() override;
+      /**
+       * @f$ M \vec{u}_0 @f$, or `_M_initial` on the coarse level.
+       *
+       * The product is only computed if the initial state changed since the last call.
+       */
+      virtual shared_ptr<typename traits::encap_t> M_initial_state();
       //! @}
 
       //! @name Problem Equation Evaluation
@@ -119,22 +143,48 @@ namespace pfasst
       /**
        * Evaluation of the explicit part of the problem equation's right hand side: @f$ F_E(\vec{u}, t) @f$.
        *
+       * Convenience wrapper around the in-place version allocating a new Encapsulation for the
+       * result.
+       *
        * @param[in] t  time point to evaluate @f$ F_E(\vec{u},t) @f$ at
        * @param[in] u  spatial data to be passed to @f$ F_E(\vec{u},t) @f$
        * @returns spatial values of function evaluation
        */
       virtual shared_ptr<typename SweeperTrait::encap_t> evaluate_rhs_expl(const typename SweeperTrait::time_t& t,
                                                                            const shared_ptr<typename SweeperTrait::encap_t> u);
+      /**
+       * In-place evaluation of the explicit part of the problem equation's right hand side.
+       *
+       * @param[in]  t       time point to evaluate @f$ F_E(\vec{u},t) @f$ at
+       * @param[in]  u       spatial data to be passed to @f$ F_E(\vec{u},t) @f$
+       * @param[out] result  spatial values of function evaluation; must not be the same as @p u
+       */
+      virtual void evaluate_rhs_expl(const typename SweeperTrait::time_t& t,
+                                     const shared_ptr<typename SweeperTrait::encap_t> u,
+                                     shared_ptr<typename SweeperTrait::encap_t> result);
       
       /**
        * Evaluation of the implicit part of the problem equation's right hand side: @f$ F_I(\vec{u}, t) @f$.
        *
+       * Convenience wrapper around the in-place version allocating a new Encapsulation for the
+       * result.
+       *
        * @param[in] t  time point to evaluate @f$ F_I(\vec{u},t) @f$ at
        * @param[in] u  spatial data to be passed to @f$ F_I(\vec{u},t) @f$
        * @returns spatial values of function evaluation
        */
       virtual shared_ptr<typename SweeperTrait::encap_t> evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
                                                                            const shared_ptr<typename SweeperTrait::encap_t> u);
+      /**
+       * In-place evaluation of the implicit part of the problem equation's right hand side.
+       *
+       * @param[in]  t       time point to evaluate @f$ F_I(\vec{u},t) @f$ at
+       * @param[in]  u       spatial data to be passed to @f$ F_I(\vec{u},t) @f$
+       * @param[out] result  spatial values of function evaluation; must not be the same as @p u
+       */
+      virtual void evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
+                                     const shared_ptr<typename SweeperTrait::encap_t> u,
+                                     shared_ptr<typename SweeperTrait::encap_t> result);
       /**
        * Implicitly solving the implicit SDC equation.
        *
@@ -178,6 +228,13 @@ namespace pfasst
 
       //! @name Configuration and Setup
       //! @{
+      /**
+       * @copybrief Sweeper::set_options()
+       *
+       * Additionally reads the setup of the implicit solves (runtime parameters `impl_direct`,
+       * `impl_preconditioner` and `impl_recycle`).
+       */
+      virtual void set_options() override;
       /**
        * @copybrief Sweeper::setup()
        *
@@ -278,6 +335,9 @@ namespace pfasst
             
       virtual vector<shared_ptr<typename SweeperTrait::encap_t>> integrate_new(const typename SweeperTrait::time_t& dt);
   
+      //! @f$ y = M x @f$, e.g. for the FAS corrections of the transfer
+      void mass_mv(const VectorType& x, VectorType& y) const { M_dune.mv(x, y); }
+
       shared_ptr<MatrixType> get_M_dune(){return make_shared<MatrixType>(M_dune);};
       shared_ptr<MatrixType> get_A_dune() {return make_shared<MatrixType>(A_dune);};
   };
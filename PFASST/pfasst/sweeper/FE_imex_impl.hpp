@@ -23,6 +23,8 @@ namespace pfasst
       , _expl_rhs(0)
       , _impl_rhs(0)
       , _impl_rhs_restrict(0)
+      , _M_u0(nullptr)
+      , _M_u0_version(0)
       , _num_impl_f_evals(0)
       , _num_expl_f_evals(0)
       , _num_impl_solves(0)
@@ -37,26 +39,70 @@ namespace pfasst
     const auto num_nodes = this->get_quadrature()->get_num_nodes();
     assert(this->get_states().size() == num_nodes + 1);
 
-    this->_q_integrals.resize(num_nodes + 1);
-    std::generate(this->_q_integrals.begin(), this->_q_integrals.end(),
-             std::bind(&traits::encap_t::factory_t::create, this->encap_factory()));
+    this->_q_integrals = this->create_nodes(num_nodes + 1);
 
-     this->_expl_rhs.resize(num_nodes + 1);
-     std::generate(this->_expl_rhs.begin(), this->_expl_rhs.end(),
-              std::bind(&traits::encap_t::factory_t::create, this->encap_factory()));
+     this->_expl_rhs = this->create_nodes(num_nodes + 1);
     
-    this->_impl_rhs.resize(num_nodes + 1);
-    std::generate(this->_impl_rhs.begin(), this->_impl_rhs.end(),
-             std::bind(&traits::encap_t::factory_t::create, this->encap_factory()));
+    this->_impl_rhs = this->create_nodes(num_nodes + 1);
     
-    this->_impl_rhs_restrict.resize(num_nodes + 1);
-    std::generate(this->_impl_rhs_restrict.begin(), this->_impl_rhs_restrict.end(),
-             std::bind(&traits::encap_t::factory_t::create, this->encap_factory()));
+    this->_impl_rhs_restrict = this->create_nodes(num_nodes + 1);
+
+    this->_M_u0 = this->get_encap_factory().create();
+    this->_M_u0_version = 0;
     
 
     this->compute_delta_matrices();
   }
 
+  template<class SweeperTrait, typename Enabled>
+  shared_ptr<typename SweeperTrait::encap_t>
+  IMEX<SweeperTrait, Enabled>::M_initial_state()
+  {
+    if (is_coarse) {
+      return this->_M_initial;
+    }
+
+    assert(this->_M_u0 != nullptr);
+    // versions start at 1, hence 0 marks an empty cache
+    if (this->_M_u0_version != this->_state_versions.front()) {
+      M_dune.mv(this->get_initial_state()->get_data(), this->_M_u0->data());
+      this->_M_u0_version = this->_state_versions.front();
+    }
+    return this->_M_u0;
+  }
+
+  template<class SweeperTrait, typename Enabled>
+  void
+  IMEX<SweeperTrait, Enabled>::set_options()
+  {
+    pfasst::Sweeper<SweeperTrait, Enabled>::set_options();
+
+    this->_impl_operators.set_direct(config::get_value<bool>("impl_direct", this->_impl_operators.is_direct()));
+    ML_CVLOG(3, this->get_logger_id(), "  direct implicit solves:      " << std::boolalpha
+                                        << this->_impl_operators.is_direct());
+
+    const string preconditioner = config::get_value<string>("impl_preconditioner", "ilu0");
+    if (preconditioner == "none") {
+      this->_impl_operators.set_preconditioner(preconditioner_t::NONE);
+    } else if (preconditioner == "jacobi") {
+      this->_impl_operators.set_preconditioner(preconditioner_t::JACOBI);
+    } else if (preconditioner == "ilu0") {
+      this->_impl_operators.set_preconditioner(preconditioner_t::ILU0);
+    } else if (preconditioner == "ssor") {
+      this->_impl_operators.set_preconditioner(preconditioner_t::SSOR);
+    } else if (preconditioner == "amg") {
+      this->_impl_operators.set_preconditioner(preconditioner_t::AMG);
+    } else {
+      ML_CLOG(ERROR, this->get_logger_id(), "unknown preconditioner '" << preconditioner
+                                            << "' (expected none, jacobi, ilu0, ssor or amg)");
+      throw std::runtime_error("unknown preconditioner for implicit solves: " + preconditioner);
+    }
+    ML_CVLOG(3, this->get_logger_id(), "  implicit preconditioner:     " << preconditioner);
+
+    this->_impl_operators.set_recycle(config::get_value<size_t>("impl_recycle", 0));
+    ML_CVLOG(3, this->get_logger_id(), "  recycled CG directions:      " << this->_impl_operators.get_recycle());
+  }
+
   template<class SweeperTrait, typename Enabled>
   void
   IMEX<SweeperTrait, Enabled>::setup()
@@ -95,12 +141,13 @@ namespace pfasst
     const typename traits::time_t dt = this->get_status()->get_dt();
 
     assert(this->get_quadrature() != nullptr);
-    auto nodes = this->get_quadrature()->get_nodes();
-    nodes.insert(nodes.begin(), typename traits::time_t(0.0));
-    const size_t num_nodes = this->get_quadrature()->get_num_nodes();
+    const auto& plan = this->sweep_plan();
+    const auto& times = plan.get_times();
+    const size_t num_nodes = plan.get_num_nodes();
 
-    this->_expl_rhs.front() = this->evaluate_rhs_expl(t, this->get_states().front());
-    this->_impl_rhs.front() = this->evaluate_rhs_impl(t, this->get_states().front());
+    this->evaluate_rhs_expl(t, this->get_states().front(), this->_expl_rhs.front());
+    this->evaluate_rhs_impl(t, this->get_states().front(), this->_impl_rhs.front());
+    this->rhs_evaluated(0);
 
     ML_CLOG(INFO, this->get_logger_id(),  "Predicting from t=" << t << " over " << num_nodes << " nodes"
                           << " to t=" << (t + dt) << " (dt=" << dt << ")");
@@ -108,9 +155,10 @@ namespace pfasst
 
     for (size_t m = 0; m < num_nodes; ++m) {
       this->states()[m + 1]->data() = this->states()[m]->data();
-      this->_impl_rhs[m + 1] = this->evaluate_rhs_impl(tm, this->get_states()[m + 1]);
-      tm += dt *  (nodes[m+1] - nodes[m]);
-      this->_expl_rhs[m + 1] = this->evaluate_rhs_expl(tm, this->get_states()[m + 1]);
+      this->evaluate_rhs_impl(tm, this->get_states()[m + 1], this->_impl_rhs[m + 1]);
+      tm = times[m + 1];
+      this->evaluate_rhs_expl(tm, this->get_states()[m + 1], this->_expl_rhs[m + 1]);
+      this->rhs_evaluated(m + 1);
       ML_CVLOG(1, this->get_logger_id(), "");
 
     }
@@ -143,31 +191,28 @@ namespace pfasst
 
 
 	
-    const typename traits::time_t dt = this->get_status()->get_dt();
-    const auto q_mat = this->get_quadrature()->get_q_mat();
-    auto nodes = this->get_quadrature()->get_nodes();
-    nodes.insert(nodes.begin(), typename traits::time_t(0.0));
-    const size_t num_nodes = this->get_quadrature()->get_num_nodes();
+    const auto& plan = this->sweep_plan();
+    const size_t num_nodes = plan.get_num_nodes();
 
     ML_CVLOG(4, this->get_logger_id(), "computing integrals");
     ML_CVLOG(6, this->get_logger_id(), "  q_int     = dt * Q * f_ex");
-    this->_q_integrals = encap::mat_mul_vec(dt, q_mat, this->_expl_rhs);
+    encap::mat_apply(this->_q_integrals, 1.0, plan.get_q_mat(), this->_expl_rhs, true, this->get_thread_pool());
     ML_CVLOG(6, this->get_logger_id(), "           += dt * Q * f_im");
-    encap::mat_apply(this->_q_integrals, dt, q_mat, this->_impl_rhs, false); //false
+    encap::mat_apply(this->_q_integrals, 1.0, plan.get_q_mat(), this->_impl_rhs, false, this->get_thread_pool()); //false
 
     ML_CVLOG(4, this->get_logger_id(), "  subtracting function evaluations of previous iteration and adding FAS correction");
 
-
-    for (size_t m = 0; m < num_nodes; ++m) {
+    // each node only touches its own integral
+    parallel_for(this->get_thread_pool(), num_nodes, [&](const size_t m) {
       for (size_t n = 0; n < m + 1; ++n) {
-        this->_q_integrals[m + 1]->scaled_add(-dt * this->_q_delta_expl(m + 1, n), this->_expl_rhs[n]);
-        this->_q_integrals[m + 1]->scaled_add(-dt * this->_q_delta_impl(m + 1, n + 1), this->_impl_rhs[n + 1]);
+        this->_q_integrals[m + 1]->scaled_add(-plan.get_q_delta_expl()(m + 1, n), this->_expl_rhs[n],
+                                              -plan.get_q_delta_impl()(m + 1, n + 1), this->_impl_rhs[n + 1]);
       }
 
 //       ML_CVLOG(6, this->get_logger_id(), LOG_FLOAT << "  q_int["<<(m+1)<<"] += tau["<<(m+1)<<"]                  = "
 //                                        << to_string(this->get_tau()[m + 1]));
       this->_q_integrals[m + 1]->scaled_add(1.0, this->get_tau()[m + 1]);
-    }
+    });
 
 //     for (size_t m = 0; m < num_nodes + 1; ++m) {
 //       ML_CVLOG(5, this->get_logger_id(), LOG_FLOAT << "  q_int["<<m<<"] = " << to_string(this->_q_integrals[m]));
@@ -191,48 +236,40 @@ namespace pfasst
 
     const typename traits::time_t t = this->get_status()->get_time();
     const typename traits::time_t dt = this->get_status()->get_dt();
-    auto nodes = this->get_quadrature()->get_nodes();
-    nodes.insert(nodes.begin(), typename traits::time_t(0.0));
-    const size_t num_nodes = this->get_quadrature()->get_num_nodes();
+    auto& plan = this->sweep_plan();
+    const auto& times = plan.get_times();
+    const size_t num_nodes = plan.get_num_nodes();
 
     ML_CLOG(INFO, this->get_logger_id(), "Sweeping from t=" << t << " over " << num_nodes
                           << " nodes to t=" << (t + dt) << " (dt=" << dt << ")");
 
-    this->_expl_rhs.front() = this->evaluate_rhs_expl(t, this->get_states().front());
+    this->_impl_operators.set_step_width(dt);
+
+    this->evaluate_rhs_expl(t, this->get_states().front(), this->_expl_rhs.front());
 
     typename traits::time_t tm = t;
     // note: m=0 is initial value and not a quadrature node
     for (size_t m = 0; m < num_nodes; ++m) {
-      ML_CVLOG(4, this->get_logger_id(), "propagating from t["<<m<<"]=" << (t + (dt * nodes[m]))
-                                                   << " to t["<<(m+1)<<"]=" << (t + (dt * nodes[m+1])));
+      ML_CVLOG(4, this->get_logger_id(), "propagating from t["<<m<<"]=" << times[m]
+                                                   << " to t["<<(m+1)<<"]=" << times[m + 1]);
 //       ML_CVLOG(5, this->get_logger_id(), LOG_FLOAT << "  u["<<m<<"] = " << to_string(this->get_states()[m]));
 
       // compute right hand side for implicit solve (i.e. the explicit part of the propagation)
-      shared_ptr<typename traits::encap_t> rhs = this->get_encap_factory().create();
-      // rhs = u_0
-     
-      if (is_coarse){
-        rhs->data() =  this->_M_initial->get_data(); //   this->get_states().front()->get_data();
-        std::cout << "coarse " << rhs->data()[0] << std::endl;
-          
-      }else{
-        M_dune.mv(this->get_states().front()->get_data(), rhs->data());
-        std::cout << "fine " << rhs->data()[0]  <<std::endl;
-
-        
-      }
+      shared_ptr<typename traits::encap_t> rhs = plan.scratch()[m + 1];
+      // rhs = M * u_0
+      rhs->data() = this->M_initial_state()->get_data();
 //    
       
       //ML_CVLOG(6, this->get_logger_id(), "  rhs = u[0]                    = " << to_string(rhs));
 
       // rhs += dt * \sum_{i=0}^m (QI_{m+1,i} fI(u_i^{k+1}) + QE_{m+1,i-1} fE(u_{i-1}^{k+1}) ) + QE_{m+1,m} fE(u_{m}^{k+1})
       for (size_t n = 0; n <= m; ++n) {
-        rhs->scaled_add(dt * this->_q_delta_impl(m + 1, n), this->_impl_rhs[n]);
+        rhs->scaled_add(plan.get_q_delta_impl()(m + 1, n), this->_impl_rhs[n],
+                        plan.get_q_delta_expl()(m + 1, n), this->_expl_rhs[n]);
 //         ML_CVLOG(6, this->get_logger_id(), "     += dt * QI_{"<<(m+1)<<","<<(n+1)<<"} * f_im["<<(n+1)<<"] = "
 //                             << LOG_FIXED << dt << " * " << this->_q_delta_impl(m + 1, n + 1) << " * "
 //                             << LOG_FLOAT << to_string(this->_impl_rhs[n]));
 
-           rhs->scaled_add(dt * this->_q_delta_expl(m + 1, n), this->_expl_rhs[n]);
 //         ML_CVLOG(6, this->get_logger_id(), "     += dt * QE_{"<<(m+1)<<","<<n<<"} * f_ex["<<n<<"] = "
 //                             << LOG_FIXED << dt << " * " << this->_q_delta_expl(m + 1, n) << " * "
 //                             << LOG_FLOAT << to_string(this->_expl_rhs[n]));
@@ -247,7 +284,7 @@ namespace pfasst
 
       // solve the implicit part
       ML_CVLOG(4, this->get_logger_id(), "  solve(u["<<(m+1)<<"] - dt * QI_{"<<(m+1)<<","<<(m+1)<<"} * f_im["<<(m+1)<<"] = rhs)");
-      this->implicit_solve(this->_impl_rhs[m + 1], this->states()[m + 1], tm, dt * this->_q_delta_impl(m+1, m+1), rhs);
+      this->implicit_solve(this->_impl_rhs[m + 1], this->states()[m + 1], tm, plan.get_q_delta_impl()(m+1, m+1), rhs);
 //       ML_CVLOG(5, this->get_logger_id(), "  u["<<(m+1)<<"] = " << to_string(this->get_states()[m + 1]));
 
       	/*std::cout <<  "sweeper nach imp solve " << std::endl;
@@ -256,10 +293,11 @@ namespace pfasst
         }*/
         //std::exit(0);
       // reevaluate the explicit part with the new solution value
-      tm += dt * this->_q_delta_impl(m+1, m+1);
-      this->_expl_rhs[m + 1] = this->evaluate_rhs_expl(tm, this->get_states()[m + 1]);
+      tm += plan.get_q_delta_impl()(m+1, m+1);
+      this->evaluate_rhs_expl(tm, this->get_states()[m + 1], this->_expl_rhs[m + 1]);
+      this->rhs_evaluated(m + 1);
 
-//       ML_CVLOG(4, this->get_logger_id(), LOG_FIXED << "  ==> values at t["<<(m+1)<<"]=" << (t + (dt * nodes[m+1])));
+//       ML_CVLOG(4, this->get_logger_id(), LOG_FIXED << "  ==> values at t["<<(m+1)<<"]=" << times[m + 1]);
 //       ML_CVLOG(5, this->get_logger_id(), LOG_FLOAT << "         u["<<m+1<<"]: " << to_string(this->get_states()[m + 1]));
 //       ML_CVLOG(6, this->get_logger_id(), LOG_FLOAT << "      f_ex["<<m+1<<"]: " << to_string(this->_expl_rhs[m + 1]));
 //       ML_CVLOG(6, this->get_logger_id(), LOG_FLOAT << "      f_im["<<m+1<<"]: " << to_string(this->_impl_rhs[m + 1]));
@@ -324,20 +362,30 @@ namespace pfasst
     if (initial_only) {
       assert( this->_impl_rhs.front() != nullptr);
 
-      this->_expl_rhs.front() = this->evaluate_rhs_expl(t0, this->get_initial_state());
-      this->_impl_rhs.front() = this->evaluate_rhs_impl(t0, this->get_initial_state());
+      if (this->is_rhs_stale(0)) {
+        this->evaluate_rhs_expl(t0, this->get_initial_state(), this->_expl_rhs.front());
+        this->evaluate_rhs_impl(t0, this->get_initial_state(), this->_impl_rhs.front());
+        this->rhs_evaluated(0);
+      } else {
+        this->_num_skipped_evaluations++;
+      }
 
     } else {
-      const typename traits::time_t dt = this->get_status()->get_dt();
-      auto nodes = this->get_quadrature()->get_nodes();
-      nodes.insert(nodes.begin(), 0.0);
+      const auto& times = this->sweep_plan().get_times();
 
       for (size_t m = 0; m < this->get_quadrature()->get_num_nodes() + 1; ++m) {
-        const typename traits::time_t t = t0 + dt * nodes[m];
+        const typename traits::time_t t = times[m];
         assert( this->_impl_rhs[m] != nullptr);
 
-        this->_expl_rhs[m] = this->evaluate_rhs_expl(t, this->get_states()[m]);
-        this->_impl_rhs[m] = this->evaluate_rhs_impl(t, this->get_states()[m]);
+        // states the last transfer left (almost) unchanged keep their evaluation
+        if (!this->is_rhs_stale(m)) {
+          this->_num_skipped_evaluations++;
+          continue;
+        }
+
+        this->evaluate_rhs_expl(t, this->get_states()[m], this->_expl_rhs[m]);
+        this->evaluate_rhs_impl(t, this->get_states()[m], this->_impl_rhs[m]);
+        this->rhs_evaluated(m);
       }
     }
   }
@@ -353,7 +401,7 @@ namespace pfasst
   vector<shared_ptr<typename SweeperTrait::encap_t>>
   IMEX<SweeperTrait, Enabled>::integrate(const typename SweeperTrait::time_t& dt)
   {
-    auto const q_mat = this->get_quadrature()->get_q_mat();
+    const auto& q_mat = this->get_quadrature()->get_q_mat();
 
     auto result = encap::mat_mul_vec(dt, q_mat, this->_expl_rhs);
     //auto result = encap::mat_mul_vec(dt, q_mat, this->_impl_rhs);
@@ -368,7 +416,7 @@ namespace pfasst
   vector<shared_ptr<typename SweeperTrait::encap_t>>
   IMEX<SweeperTrait, Enabled>::integrate_new(const typename SweeperTrait::time_t& dt)
   {
-    auto const q_mat = this->get_quadrature()->get_q_mat();
+    const auto& q_mat = this->get_quadrature()->get_q_mat();
 
     //vector<shared_ptr<typename SweeperTrait::encap_t>>&
     
@@ -411,8 +459,8 @@ namespace pfasst
     assert(this->get_quadrature() != nullptr);
     assert(this->get_initial_state() != nullptr);
 
-    const typename traits::time_t dt = this->get_status()->get_dt();
     const size_t num_nodes = this->get_quadrature()->get_num_nodes() + 1;
+    const auto& plan = this->sweep_plan();
 
     if (only_last) {
       const size_t cols = this->get_quadrature()->get_q_mat().cols();
@@ -420,81 +468,38 @@ namespace pfasst
       
       
       
-      if (is_coarse){
-        this->residuals().back()->data() =  this->_M_initial->get_data(); //   this->get_states().front()->get_data();
-      }else{
-        M_dune.mv(this->get_initial_state()->get_data(), this->residuals().back()->data());
-      }
-      
-      //M_dune.mv(this->get_initial_state()->get_data(), this->residuals().back()->data());
-      //this->residuals().back()->data() = this->get_initial_state()->get_data();
-      
-      shared_ptr<typename traits::encap_t> uM = this->get_encap_factory().create();	
-      M_dune.mv(this->get_states().back()->get_data(), uM->data());
-      this->residuals().back()->scaled_add(-1.0, uM);	
-      //this->residuals()[m]->scaled_add(-1.0,uM);
-
-      
-      
+      this->residuals().back()->data() = this->M_initial_state()->get_data();
+      M_dune.mmv(this->get_states().back()->get_data(), this->residuals().back()->data());
       this->residuals().back()->scaled_add(1.0, this->get_tau().back());
       for (size_t n = 0; n < cols; ++n) {
-        this->residuals().back()->scaled_add(dt * this->get_quadrature()->get_q_mat()(rows - 1, n), this->_expl_rhs[n]);
-        this->residuals().back()->scaled_add(dt * this->get_quadrature()->get_q_mat()(rows - 1, n), this->_impl_rhs[n]);
+        this->residuals().back()->scaled_add(plan.get_q_mat()(rows - 1, n), this->_expl_rhs[n],
+                                             plan.get_q_mat()(rows - 1, n), this->_impl_rhs[n]);
       }
     } else {
-      for (size_t m = 0; m < num_nodes; ++m) {
+      // M * u_0 is the same for all nodes and cached across sweeps
+      const shared_ptr<typename traits::encap_t> uM0 = this->M_initial_state();
+
+      ML_CVLOG(5, this->get_logger_id(), "  res[m] = M * u[0] - M * u[m] + tau[m]");
+      parallel_for(this->get_thread_pool(), num_nodes, [&](const size_t m) {
         assert(this->get_states()[m] != nullptr);
         assert(this->residuals()[m] != nullptr);
-
-  //       ML_CVLOG(5, this->get_logger_id(), "  res["<<m<<"] = u[0]   = " << to_string(this->get_initial_state()));
-        //this->residuals()[m]->data() = this->get_initial_state()->get_data();
-	/*std::cout << "************* im fe_imex pointer *********************" << std::endl;	
-	for (int i=0; i< 2; i++){
-	  //std::cout <<  "A  " << this->A_dune[i][i] << std::endl;
-	  std::cout <<  "M  " << (M_dune)[i][i] << std::endl;
-        }
-	std::cout << "**********************************" << std::endl;	*/
-	
-    
-    if (is_coarse){
-        this->residuals()[m]->data() =  this->_M_initial->get_data(); //   this->get_states().front()->get_data();
-    }else{
-        M_dune.mv(this->get_initial_state()->get_data(), this->residuals()[m]->data());
-    }
-    
-	//M_dune.mv(this->get_initial_state()->get_data(), this->residuals()[m]->data());
-
-  //       ML_CVLOG(5, this->get_logger_id(), "        -= u["<<m<<"]   = " << to_string(this->get_states()[m]));
-	
-	shared_ptr<typename traits::encap_t> uM = this->get_encap_factory().create();
-	
-
-	M_dune.mv(this->get_states()[m]->get_data(), uM->data());
-
-	
-	this->residuals()[m]->scaled_add(-1.0,uM);
-        //this->residuals()[m]->scaled_add(-1.0, this->get_states()[m]);
-
         assert(this->get_tau()[m] != nullptr);
-  //       ML_CVLOG(5, this->get_logger_id(), "        += tau["<<m<<"] = " << to_string(this->get_tau()[m]));
+
+        this->residuals()[m]->data() = uM0->get_data();
+        M_dune.mmv(this->get_states()[m]->get_data(), this->residuals()[m]->data());
         this->residuals()[m]->scaled_add(1.0, this->get_tau()[m]);
-      }
+      });
 
-      //ML_CVLOG(5, this->get_logger_id(), "  res += dt * Q * F_ex");
-      encap::mat_apply(this->residuals(), dt, this->get_quadrature()->get_q_mat(), this->_expl_rhs, false);
+      ML_CVLOG(5, this->get_logger_id(), "  res += dt * Q * F_ex");
+      encap::mat_apply(this->residuals(), 1.0, plan.get_q_mat(), this->_expl_rhs, false, this->get_thread_pool());
 
       ML_CVLOG(5, this->get_logger_id(), "  res += dt * Q * F_im");
-      encap::mat_apply(this->residuals(), dt, this->get_quadrature()->get_q_mat(), this->_impl_rhs, false);
+      encap::mat_apply(this->residuals(), 1.0, plan.get_q_mat(), this->_impl_rhs, false, this->get_thread_pool());
 
       ML_CVLOG(5, this->get_logger_id(), "  ==>");
       for (size_t m = 0; m < num_nodes; ++m) {
-        //ML_CVLOG(5, this->get_logger_id(), "    |res["<<m<<"]| = " << LOG_FLOAT << this->get_residuals()[m]->norm0());
         ML_CVLOG(5, this->get_logger_id(), "    |res["<<m<<"]| = " << this->get_residuals()[m]->norm0());
-  //                                       << "    res["<<m<<"] = " << to_string(this->get_residuals()[m]));
-      
-
       }
-      
     }
     //std::exit(0);
   }
@@ -519,27 +524,49 @@ namespace pfasst
     this->compute_residuals(false);
   }
 
-  /**
-   * @throws std::runtime_error if not overwritten in specialized implementation
-   */
   template<class SweeperTrait, typename Enabled>
   shared_ptr<typename SweeperTrait::encap_t>
   IMEX<SweeperTrait, Enabled>::evaluate_rhs_expl(const typename SweeperTrait::time_t& t,
                                                  const shared_ptr<typename SweeperTrait::encap_t> u)
   {
-    UNUSED(t); UNUSED(u);
-    throw std::runtime_error("evaluation of explicit part of right-hand-side");
+    auto result = this->get_encap_factory().create();
+    this->evaluate_rhs_expl(t, u, result);
+    return result;
   }
 
   /**
    * @throws std::runtime_error if not overwritten in specialized implementation
    */
+  template<class SweeperTrait, typename Enabled>
+  void
+  IMEX<SweeperTrait, Enabled>::evaluate_rhs_expl(const typename SweeperTrait::time_t& t,
+                                                 const shared_ptr<typename SweeperTrait::encap_t> u,
+                                                 shared_ptr<typename SweeperTrait::encap_t> result)
+  {
+    UNUSED(t); UNUSED(u); UNUSED(result);
+    throw std::runtime_error("evaluation of explicit part of right-hand-side");
+  }
+
   template<class SweeperTrait, typename Enabled>
   shared_ptr<typename SweeperTrait::encap_t>
   IMEX<SweeperTrait, Enabled>::evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
                                                  const shared_ptr<typename SweeperTrait::encap_t> u)
   {
-    UNUSED(t); UNUSED(u);
+    auto result = this->get_encap_factory().create();
+    this->evaluate_rhs_impl(t, u, result);
+    return result;
+  }
+
+  /**
+   * @throws std::runtime_error if not overwritten in specialized implementation
+   */
+  template<class SweeperTrait, typename Enabled>
+  void
+  IMEX<SweeperTrait, Enabled>::evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
+                                                 const shared_ptr<typename SweeperTrait::encap_t> u,
+                                                 shared_ptr<typename SweeperTrait::encap_t> result)
+  {
+    UNUSED(t); UNUSED(u); UNUSED(result);
     throw std::runtime_error("evaluation of implicit part of right-hand-side");
   }
 
@@ -669,5 +696,7 @@ namespace pfasst
       ML_CVLOG(5, this->get_logger_id(),
                "  " << this->_q_delta_impl.block(row, 0, 1, this->_q_delta_impl.cols()));
     }
+
+    this->_plan.set_delta_matrices(this->_q_delta_impl, this->_q_delta_expl);
   }
 }  // ::pfasst
@@ -1,12 +1,15 @@
 #ifndef _PFASST__SWEEPER__IMEX_HPP_
 #define _PFASST__SWEEPER__IMEX_HPP_
 
+#include <atomic>
 #include <memory>
 #include <vector>
 using std::shared_ptr;
 using std::vector;
 
 #include "pfasst/sweeper/sweeper.hpp"
+#include "pfasst/sweeper/implicit_operator_cache.hpp"
+#include "pfasst/node_pool.hpp"
 
 //#include "../../../src/finite_element_stuff/fe_manager_fp.hpp"
 
@@ -71,11 +74,42 @@ namespace pfasst
       /**
        * Delta Matrix for the implicit function evaluations.
        *
-       * This is a lower triangonal matrix with non-zero diagonal.
+       * This is a lower triangonal matrix with non-zero diagonal, or a diagonal matrix.
        *
        * @see IMEX::compute_delta_matrices()
        */
       Matrix<typename traits::time_t> _q_delta_impl;
+      /**
+       * Choice of @f$ Q_\Delta @f$ for the implicit part.
+       *
+       * Set via the runtime parameter `q_delta` (`lu`, `implicit_euler` or `min_sr_ns`).
+       */
+      enum class q_delta_t {
+        //! @f$ U^T @f$ of the LU decomposition of @f$ Q^T @f$
+        LU,
+        //! implicit Euler steps between the nodes
+        IMPLICIT_EULER,
+        //! diagonal @f$ \tau_m / M @f$ minimizing the spectral radius in the non-stiff limit
+        MIN_SR_NS
+      };
+      q_delta_t                                    _q_delta_type;
+      //! Whether `_q_delta_impl` is diagonal, i.e. the implicit solves of one sweep are independent.
+      bool                                         _q_delta_diagonal;
+      /**
+       * Threads solving the nodes of a sweep concurrently.
+       *
+       * Only set up with `node_threads > 1` and only used with a diagonal @f$ Q_\Delta @f$.
+       * `implicit_solve()` must then be safe to call concurrently for different nodes.
+       */
+      shared_ptr<NodePool>                         _node_pool;
+      /**
+       * Whether sweeps with a diagonal @f$ Q_\Delta @f$ hand all nodes to `implicit_solve_batch()`.
+       *
+       * Set via the runtime parameter `impl_batch`; takes precedence over `_node_pool`.
+       * `set_options()` rejects it unless `_impl_operators.can_batch()`, i.e. with a preconditioner
+       * other than none or jacobi, recycled directions or direct solves.
+       */
+      bool                                         _impl_batch;
 
       //! Cache for the integral @f$ QF_n @f$.
       vector<shared_ptr<typename traits::encap_t>> _q_integrals;
@@ -84,6 +118,14 @@ namespace pfasst
       //! Cache for the implicit function evaluations @f$ F_I(\vec{u}_n, t_n) @f$.
       vector<shared_ptr<typename traits::encap_t>> _impl_rhs;
       vector<shared_ptr<typename traits::encap_t>> _impl_rhs_restrict;
+      /**
+       * Cache for @f$ M \vec{u}_0 @f$ used by the sweeps and the residuals.
+       *
+       * Valid as long as `_M_u0_version` matches the version of the initial state, i.e. only recomputed
+       * after `initial_state()` was changed by `advance()`, the transfer or the communicator.
+       */
+      shared_ptr<typename traits::encap_t>         _M_u0;
+      size_t                                       _M_u0_version;
       
 
       //! Counter for total number of @f$ F_E(\vec{u},t) @f$ evaluations.
@@ -91,7 +133,37 @@ namespace pfasst
       //! Counter for total number of @f$ F_I(\vec{u},t) @f$ evaluations.
       size_t _num_impl_f_evals;
       //! Counter for total number of implicit solves.
-      size_t _num_impl_solves;
+      std::atomic<size_t> _num_impl_solves;
+      /**
+       * Assembled implicit operators @f$ M + c A @f$ of this level, one per distinct coefficient.
+       *
+       * Uses sparse direct factorizations if UMFPack is available and the runtime parameter
+       * `impl_direct=1` is given; preconditioned CG otherwise.
+       * Sweepers reassembling @f$ M @f$ or @f$ A @f$ must clear it.
+       * Iterative solves recycle up to `impl_recycle` CG directions per operator.
+       */
+      ImplicitOperatorCache<MatrixType, VectorType> _impl_operators;
+      /**
+       * Initial guess of the implicit solves.
+       *
+       * Set via the runtime parameter `initial_guess` (`zero`, `previous_iterate`, `previous_node` or
+       * `extrapolate`).
+       */
+      enum class initial_guess_t {
+        //! start from zero
+        ZERO,
+        //! start from the last iterate @f$ \vec{u}_{m+1}^k @f$ at the same node (or the prediction)
+        PREVIOUS_ITERATE,
+        //! start from the new iterate @f$ \vec{u}_m^{k+1} @f$ at the previous node
+        PREVIOUS_NODE,
+        //! start from the linear extrapolation @f$ 2 \vec{u}_{m+1}^k - \vec{u}_{m+1}^{k-1} @f$
+        EXTRAPOLATE
+      };
+      initial_guess_t                              _initial_guess;
+      //! Iterates @f$ \vec{u}^{k-1} @f$ of the current time step for `initial_guess_t::EXTRAPOLATE`.
+      vector<shared_ptr<typename traits::encap_t>> _guess_history;
+      //! Time point the iterates in `_guess_history` belong to; NaN if there are none.
+      typename traits::time_t                      _guess_history_time;
 
       //! @{
       /**
@@ -112,6 +184,18 @@ namespace pfasst
        * @copybrief Sweeper::initialize()
        */
       virtual void initialize() override;
+      /**
+       * @f$ M \vec{u}_0 @f$, or `_M_initial` on the coarse level.
+       *
+       * The product is only computed if the initial state changed since the last call.
+       */
+      virtual shared_ptr<typename traits::encap_t> M_initial_state();
+      /**
+       * @f$ y = M x @f$; sweepers not assembling `M_dune` override this and mass_mmv().
+       */
+      virtual void mass_mv(const VectorType& x, VectorType& y) const;
+      //! @f$ y \mathrel{-}= M x @f$
+      virtual void mass_mmv(const VectorType& x, VectorType& y) const;
       //! @}
 
       //! @name Problem Equation Evaluation
@@ -129,12 +213,25 @@ namespace pfasst
       /**
        * Evaluation of the implicit part of the problem equation's right hand side: @f$ F_I(\vec{u}, t) @f$.
        *
+       * Convenience wrapper around the in-place version allocating a new Encapsulation for the
+       * result.
+       *
        * @param[in] t  time point to evaluate @f$ F_I(\vec{u},t) @f$ at
        * @param[in] u  spatial data to be passed to @f$ F_I(\vec{u},t) @f$
        * @returns spatial values of function evaluation
        */
       virtual shared_ptr<typename SweeperTrait::encap_t> evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
                                                                            const shared_ptr<typename SweeperTrait::encap_t> u);
+      /**
+       * In-place evaluation of the implicit part of the problem equation's right hand side.
+       *
+       * @param[in]  t       time point to evaluate @f$ F_I(\vec{u},t) @f$ at
+       * @param[in]  u       spatial data to be passed to @f$ F_I(\vec{u},t) @f$
+       * @param[out] result  spatial values of function evaluation; must not be the same as @p u
+       */
+      virtual void evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
+                                     const shared_ptr<typename SweeperTrait::encap_t> u,
+                                     shared_ptr<typename SweeperTrait::encap_t> result);
       /**
        * Implicitly solving the implicit SDC equation.
        *
@@ -157,6 +254,32 @@ namespace pfasst
                                   const typename SweeperTrait::time_t& t,
                                   const typename SweeperTrait::time_t& dt,
                                   const shared_ptr<typename SweeperTrait::encap_t> rhs);
+      /**
+       * Implicit solves of several independent nodes at once.
+       *
+       * Solves for `u[k]` and `f[k]` as `implicit_solve(f[k], u[k], t[k], dt[k], rhs[k])` would for all
+       * @f$ k @f$.
+       * Linear problems may override this to solve all systems within one batched solver, e.g. with
+       * `ImplicitOperatorCache::solve_batch()`.
+       * The default calls `implicit_solve()` per node, through `_node_pool` if there is one.
+       */
+      virtual void implicit_solve_batch(const vector<shared_ptr<typename SweeperTrait::encap_t>>& f,
+                                        const vector<shared_ptr<typename SweeperTrait::encap_t>>& u,
+                                        const vector<typename SweeperTrait::time_t>& t,
+                                        const vector<typename SweeperTrait::time_t>& dt,
+                                        const vector<shared_ptr<typename SweeperTrait::encap_t>>& rhs);
+      /**
+       * Prepares `states()[m]` as initial guess for the implicit solve at node @p m.
+       *
+       * @see IMEX::_initial_guess
+       */
+      virtual void initial_guess(const size_t m);
+      /**
+       * Sweep with all implicit solves dispatched to `_node_pool` or `implicit_solve_batch()` at once.
+       *
+       * Requires a diagonal @f$ Q_\Delta @f$ so that no node depends on the new value of another.
+       */
+      virtual void sweep_nodes_parallel();
       //! @}
 
       //! @{
@@ -178,6 +301,14 @@ namespace pfasst
 
       //! @name Configuration and Setup
       //! @{
+      /**
+       * @copybrief Sweeper::set_options()
+       *
+       * Additionally reads the setup of the implicit solves (runtime parameters `impl_direct`,
+       * `impl_preconditioner`, `impl_recycle`, `initial_guess`, `q_delta`, `node_threads` and
+       * `impl_batch`).
+       */
+      virtual void set_options() override;
       /**
        * @copybrief Sweeper::setup()
        *
@@ -284,5 +415,6 @@ namespace pfasst
 }  // ::pfasst
 
 #include "pfasst/sweeper/FE_impl_impl.hpp"
+#include "pfasst/sweeper/FE_impl_fixed.hpp"
 
 #endif  // _PFASST__SWEEPER__IMEX_HPP_
@@ -0,0 +1,96 @@
+#ifndef _PFASST__SWEEPER__IMEX_FIXED_HPP_
+#define _PFASST__SWEEPER__IMEX_FIXED_HPP_
+
+#include <array>
+#include <memory>
+using std::shared_ptr;
+
+#include <Eigen/Core>
+
+#include "pfasst/quadrature.hpp"
+
+
+namespace pfasst
+{
+  /**
+   * IMEX sweeper for a number of quadrature nodes known at compile time.
+   *
+   * Keeps @f$ \Delta t Q_\Delta @f$ of the current step in a fixed-size Eigen matrix and the node
+   * times in a `std::array`, so the loops over the nodes in `pre_sweep()` and `sweep()` have
+   * compile-time bounds and read their coefficients from fixed-size storage.
+   * Everything else, as well as the node-parallel sweep, is inherited from the runtime sweeper
+   * `IMEX<SweeperTrait, void>`.
+   *
+   * `setup()` fails if the quadrature does not have @p NumNodes nodes; use the dispatching
+   * `quadrature::quadrature_factory()` overload to pick the matching sweeper type.
+   *
+   * @tparam SweeperTrait  type traits of the sweeper
+   * @tparam NumNodes      number of quadrature nodes, not counting the initial value
+   *
+   * @ingroup Sweepers
+   */
+  template<
+    class SweeperTrait,
+    size_t NumNodes
+  >
+  class IMEX<SweeperTrait, FixedNodes<NumNodes>>
+    : public IMEX<SweeperTrait, void>
+  {
+    static_assert(NumNodes > 0, "FixedNodes needs at least one quadrature node");
+
+    public:
+      using traits = SweeperTrait;
+      //! unaligned, as sweepers are created through `std::make_shared`, which ignores Eigen's alignment
+      using node_matrix_t = Eigen::Matrix<typename traits::time_t, NumNodes + 1, NumNodes + 1,
+                                          Eigen::RowMajor | Eigen::DontAlign>;
+      using node_times_t = std::array<typename traits::time_t, NumNodes + 1>;
+
+    protected:
+      //! @{
+      //! Copies of the sweep plan's @f$ \Delta t Q_\Delta @f$ and times, refreshed by `pre_sweep()`.
+      node_matrix_t                                _fixed_q_delta_impl;
+      node_times_t                                 _fixed_times;
+      //! @}
+
+      //! Copies the current sweep plan into the fixed-size containers.
+      virtual void update_fixed_plan();
+
+    public:
+      //! @{
+      explicit IMEX();
+      IMEX(const IMEX<SweeperTrait, FixedNodes<NumNodes>>& other) = default;
+      IMEX(IMEX<SweeperTrait, FixedNodes<NumNodes>>&& other) = default;
+      virtual ~IMEX() = default;
+      IMEX<SweeperTrait, FixedNodes<NumNodes>>& operator=(const IMEX<SweeperTrait, FixedNodes<NumNodes>>& other) = default;
+      IMEX<SweeperTrait, FixedNodes<NumNodes>>& operator=(IMEX<SweeperTrait, FixedNodes<NumNodes>>&& other) = default;
+      //! @}
+
+      /**
+       * @copybrief IMEX::setup()
+       *
+       * Additionally checks that the quadrature has @p NumNodes nodes.
+       */
+      virtual void setup() override;
+
+      //! @name Sweep Step
+      //! @{
+      /**
+       * @copybrief IMEX::pre_sweep()
+       *
+       * Same as the runtime version with the node loops unrolled.
+       */
+      virtual void pre_sweep() override;
+      /**
+       * @copybrief IMEX::sweep()
+       *
+       * Same as the runtime version with the node loops unrolled; node-parallel sweeps are left to
+       * `IMEX<SweeperTrait, void>::sweep()`.
+       */
+      virtual void sweep() override;
+      //! @}
+  };
+}  // ::pfasst
+
+#include "pfasst/sweeper/FE_impl_fixed_impl.hpp"
+
+#endif  // _PFASST__SWEEPER__IMEX_FIXED_HPP_
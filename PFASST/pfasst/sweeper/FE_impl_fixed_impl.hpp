@@ -0,0 +1,122 @@
+#include "pfasst/sweeper/FE_impl_fixed.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+
+namespace pfasst
+{
+  template<class SweeperTrait, size_t NumNodes>
+  IMEX<SweeperTrait, FixedNodes<NumNodes>>::IMEX()
+    :   IMEX<SweeperTrait, void>()
+      , _fixed_q_delta_impl(node_matrix_t::Zero())
+  {
+    this->_fixed_times.fill(typename traits::time_t(0.0));
+  }
+
+  template<class SweeperTrait, size_t NumNodes>
+  void
+  IMEX<SweeperTrait, FixedNodes<NumNodes>>::update_fixed_plan()
+  {
+    const auto& plan = this->sweep_plan();
+    assert(plan.get_num_nodes() == NumNodes);
+
+    this->_fixed_q_delta_impl = plan.get_q_delta_impl();
+    std::copy(plan.get_times().begin(), plan.get_times().end(), this->_fixed_times.begin());
+  }
+
+  template<class SweeperTrait, size_t NumNodes>
+  void
+  IMEX<SweeperTrait, FixedNodes<NumNodes>>::setup()
+  {
+    if (this->get_quadrature()->get_num_nodes() != NumNodes) {
+      ML_CLOG(ERROR, this->get_logger_id(), "sweeper compiled for " << NumNodes << " nodes but quadrature has "
+                                            << this->get_quadrature()->get_num_nodes());
+      throw std::runtime_error("number of quadrature nodes does not match FixedNodes<"
+                               + std::to_string(NumNodes) + ">");
+    }
+
+    IMEX<SweeperTrait, void>::setup();
+  }
+
+  template<class SweeperTrait, size_t NumNodes>
+  void
+  IMEX<SweeperTrait, FixedNodes<NumNodes>>::pre_sweep()
+  {
+    Sweeper<SweeperTrait, void>::pre_sweep();
+
+    assert(this->get_quadrature() != nullptr);
+    assert(this->get_status() != nullptr);
+
+    ML_CLOG_IF(this->get_quadrature()->left_is_node(), WARNING, this->get_logger_id(),
+      "IMEX Sweeper for quadrature nodes containing t_0 not implemented and tested.");
+
+    this->update_fixed_plan();
+    const auto& plan = this->sweep_plan();
+
+    ML_CVLOG(4, this->get_logger_id(), "computing integrals");
+    ML_CVLOG(6, this->get_logger_id(), "  q_int     = dt * Q * f_im");
+    encap::mat_apply(this->_q_integrals, 1.0, plan.get_q_mat(), this->_impl_rhs, true, this->get_thread_pool());
+
+    ML_CVLOG(4, this->get_logger_id(), "  subtracting function evaluations of previous iteration and adding FAS correction");
+
+    // each node only touches its own integral
+    parallel_for(this->get_thread_pool(), NumNodes, [&](const size_t m) {
+      for (size_t n = 0; n < m + 1; ++n) {
+        this->_q_integrals[m + 1]->scaled_add(-this->_fixed_q_delta_impl(m + 1, n + 1), this->_impl_rhs[n + 1]);
+      }
+      this->_q_integrals[m + 1]->scaled_add(1.0, this->get_tau()[m + 1]);
+    });
+  }
+
+  template<class SweeperTrait, size_t NumNodes>
+  void
+  IMEX<SweeperTrait, FixedNodes<NumNodes>>::sweep()
+  {
+    if ((this->_node_pool || this->_impl_batch) && this->_q_delta_diagonal) {
+      IMEX<SweeperTrait, void>::sweep();
+      return;
+    }
+
+    Sweeper<SweeperTrait, void>::sweep();
+
+    assert(this->get_quadrature() != nullptr);
+    assert(this->get_status() != nullptr);
+
+    ML_CLOG_IF(this->get_quadrature()->left_is_node(), WARNING, this->get_logger_id(),
+      "IMEX Sweeper for quadrature nodes containing t_0 not implemented and tested.");
+
+    const typename traits::time_t t = this->get_status()->get_time();
+    const typename traits::time_t dt = this->get_status()->get_dt();
+    auto& scratch = this->sweep_plan().scratch();
+
+    ML_CLOG(INFO, this->get_logger_id(), "Sweeping from t=" << t << " over " << NumNodes
+                          << " nodes to t=" << (t + dt) << " (dt=" << dt << ")");
+
+    this->_impl_operators.set_step_width(dt);
+
+    typename traits::time_t tm = t;
+    // note: m=0 is initial value and not a quadrature node
+    for (size_t m = 0; m < NumNodes; ++m) {
+      ML_CVLOG(4, this->get_logger_id(), "propagating from t["<<m<<"]=" << this->_fixed_times[m]
+                                                   << " to t["<<(m+1)<<"]=" << this->_fixed_times[m + 1]);
+
+      // rhs = M * u_0 + dt * \sum_{i=0}^m QI_{m+1,i} fI(u_i^{k+1}) + q_int[m+1]
+      shared_ptr<typename traits::encap_t> rhs = scratch[m + 1];
+      rhs->data() = this->M_initial_state()->get_data();
+      for (size_t n = 0; n <= m; ++n) {
+        rhs->scaled_add(this->_fixed_q_delta_impl(m + 1, n), this->_impl_rhs[n]);
+      }
+      rhs->scaled_add(1.0, this->_q_integrals[m + 1]);
+
+      ML_CVLOG(4, this->get_logger_id(), "  solve(u["<<(m+1)<<"] - dt * QI_{"<<(m+1)<<","<<(m+1)<<"} * f_im["<<(m+1)<<"] = rhs)");
+      this->initial_guess(m + 1);
+      this->implicit_solve(this->_impl_rhs[m + 1], this->states()[m + 1], tm, this->_fixed_q_delta_impl(m + 1, m + 1), rhs);
+      this->rhs_evaluated(m + 1);
+
+      tm += this->_fixed_q_delta_impl(m + 1, m + 1);
+      ML_CVLOG(4, this->get_logger_id(), "");
+    }
+  }
+}  // ::pfasst
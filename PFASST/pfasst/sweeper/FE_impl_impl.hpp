@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <limits>
 #include <stdexcept>
 #include <memory>
 #include <vector>
@@ -19,11 +20,20 @@ namespace pfasst
   template<class SweeperTrait, typename Enabled>
   IMEX<SweeperTrait, Enabled>::IMEX()
     :   Sweeper<SweeperTrait, Enabled>()
+      , _q_delta_type(q_delta_t::LU)
+      , _q_delta_diagonal(false)
+      , _node_pool(nullptr)
+      , _impl_batch(false)
       , _q_integrals(0)
       , _impl_rhs(0)
       , _impl_rhs_restrict(0)
+      , _M_u0(nullptr)
+      , _M_u0_version(0)
       , _num_impl_f_evals(0)
       , _num_impl_solves(0)
+      , _initial_guess(initial_guess_t::PREVIOUS_ITERATE)
+      , _guess_history(0)
+      , _guess_history_time(std::numeric_limits<typename traits::time_t>::quiet_NaN())
   {}
 
   template<class SweeperTrait, typename Enabled>
@@ -35,22 +45,135 @@ namespace pfasst
     const auto num_nodes = this->get_quadrature()->get_num_nodes();
     assert(this->get_states().size() == num_nodes + 1);
 
-    this->_q_integrals.resize(num_nodes + 1);
-    std::generate(this->_q_integrals.begin(), this->_q_integrals.end(),
-             std::bind(&traits::encap_t::factory_t::create, this->encap_factory()));
+    this->_q_integrals = this->create_nodes(num_nodes + 1);
 
-    this->_impl_rhs.resize(num_nodes + 1);
-    std::generate(this->_impl_rhs.begin(), this->_impl_rhs.end(),
-             std::bind(&traits::encap_t::factory_t::create, this->encap_factory()));
+    this->_impl_rhs = this->create_nodes(num_nodes + 1);
     
-    this->_impl_rhs_restrict.resize(num_nodes + 1);
-    std::generate(this->_impl_rhs_restrict.begin(), this->_impl_rhs_restrict.end(),
-             std::bind(&traits::encap_t::factory_t::create, this->encap_factory()));
+    this->_impl_rhs_restrict = this->create_nodes(num_nodes + 1);
+
+    this->_M_u0 = this->get_encap_factory().create();
+    this->_M_u0_version = 0;
     
 
     this->compute_delta_matrices();
   }
 
+  template<class SweeperTrait, typename Enabled>
+  shared_ptr<typename SweeperTrait::encap_t>
+  IMEX<SweeperTrait, Enabled>::M_initial_state()
+  {
+    if (is_coarse) {
+      return this->_M_initial;
+    }
+
+    assert(this->_M_u0 != nullptr);
+    // versions start at 1, hence 0 marks an empty cache
+    if (this->_M_u0_version != this->_state_versions.front()) {
+      this->mass_mv(this->get_initial_state()->get_data(), this->_M_u0->data());
+      this->_M_u0_version = this->_state_versions.front();
+    }
+    return this->_M_u0;
+  }
+
+  template<class SweeperTrait, typename Enabled>
+  void
+  IMEX<SweeperTrait, Enabled>::mass_mv(const VectorType& x, VectorType& y) const
+  {
+    M_dune.mv(x, y);
+  }
+
+  template<class SweeperTrait, typename Enabled>
+  void
+  IMEX<SweeperTrait, Enabled>::mass_mmv(const VectorType& x, VectorType& y) const
+  {
+    M_dune.mmv(x, y);
+  }
+
+  template<class SweeperTrait, typename Enabled>
+  void
+  IMEX<SweeperTrait, Enabled>::set_options()
+  {
+    pfasst::Sweeper<SweeperTrait, Enabled>::set_options();
+
+    this->_impl_operators.set_direct(config::get_value<bool>("impl_direct", this->_impl_operators.is_direct()));
+    ML_CVLOG(3, this->get_logger_id(), "  direct implicit solves:      " << std::boolalpha
+                                        << this->_impl_operators.is_direct());
+
+    const string preconditioner = config::get_value<string>("impl_preconditioner", "ilu0");
+    if (preconditioner == "none") {
+      this->_impl_operators.set_preconditioner(preconditioner_t::NONE);
+    } else if (preconditioner == "jacobi") {
+      this->_impl_operators.set_preconditioner(preconditioner_t::JACOBI);
+    } else if (preconditioner == "ilu0") {
+      this->_impl_operators.set_preconditioner(preconditioner_t::ILU0);
+    } else if (preconditioner == "ssor") {
+      this->_impl_operators.set_preconditioner(preconditioner_t::SSOR);
+    } else if (preconditioner == "amg") {
+      this->_impl_operators.set_preconditioner(preconditioner_t::AMG);
+    } else {
+      ML_CLOG(ERROR, this->get_logger_id(), "unknown preconditioner '" << preconditioner
+                                            << "' (expected none, jacobi, ilu0, ssor or amg)");
+      throw std::runtime_error("unknown preconditioner for implicit solves: " + preconditioner);
+    }
+    ML_CVLOG(3, this->get_logger_id(), "  implicit preconditioner:     " << preconditioner);
+
+    this->_impl_operators.set_recycle(config::get_value<size_t>("impl_recycle", 0));
+    ML_CVLOG(3, this->get_logger_id(), "  recycled CG directions:      " << this->_impl_operators.get_recycle());
+
+    const string guess = config::get_value<string>("initial_guess", "previous_iterate");
+    if (guess == "zero") {
+      this->_initial_guess = initial_guess_t::ZERO;
+    } else if (guess == "previous_iterate") {
+      this->_initial_guess = initial_guess_t::PREVIOUS_ITERATE;
+    } else if (guess == "previous_node") {
+      this->_initial_guess = initial_guess_t::PREVIOUS_NODE;
+    } else if (guess == "extrapolate") {
+      this->_initial_guess = initial_guess_t::EXTRAPOLATE;
+    } else {
+      ML_CLOG(ERROR, this->get_logger_id(), "unknown initial guess '" << guess
+                                            << "' (expected zero, previous_iterate, previous_node or extrapolate)");
+      throw std::runtime_error("unknown initial guess for implicit solves: " + guess);
+    }
+    ML_CVLOG(3, this->get_logger_id(), "  initial guess of solves:     " << guess);
+
+    const string q_delta = config::get_value<string>("q_delta", "lu");
+    if (q_delta == "lu") {
+      this->_q_delta_type = q_delta_t::LU;
+    } else if (q_delta == "implicit_euler") {
+      this->_q_delta_type = q_delta_t::IMPLICIT_EULER;
+    } else if (q_delta == "min_sr_ns") {
+      this->_q_delta_type = q_delta_t::MIN_SR_NS;
+    } else {
+      ML_CLOG(ERROR, this->get_logger_id(), "unknown Q_delta '" << q_delta
+                                            << "' (expected lu, implicit_euler or min_sr_ns)");
+      throw std::runtime_error("unknown Q_delta: " + q_delta);
+    }
+    ML_CVLOG(3, this->get_logger_id(), "  Q_delta:                     " << q_delta);
+
+    const size_t node_threads = config::get_value<size_t>("node_threads", 1);
+    if (node_threads > 1) {
+      ML_CLOG_IF(this->_q_delta_type != q_delta_t::MIN_SR_NS, WARNING, this->get_logger_id(),
+        "node_threads=" << node_threads << " has no effect unless Q_delta is diagonal (q_delta=min_sr_ns)");
+      this->_node_pool = std::make_shared<NodePool>(node_threads);
+    } else {
+      this->_node_pool = nullptr;
+    }
+    ML_CVLOG(3, this->get_logger_id(), "  threads per sweep:           " << node_threads);
+
+    this->_impl_batch = config::get_value<bool>("impl_batch", false);
+    ML_CLOG_IF(this->_impl_batch && this->_q_delta_type != q_delta_t::MIN_SR_NS, WARNING, this->get_logger_id(),
+      "impl_batch has no effect unless Q_delta is diagonal (q_delta=min_sr_ns)");
+    if (this->_impl_batch && !this->_impl_operators.can_batch()) {
+      ML_CLOG(ERROR, this->get_logger_id(), "impl_batch needs impl_preconditioner=none or jacobi,"
+                                            << " impl_recycle=0 and impl_direct=false"
+                                            << " (got impl_preconditioner=" << preconditioner
+                                            << ", impl_recycle=" << this->_impl_operators.get_recycle()
+                                            << ", impl_direct=" << std::boolalpha << this->_impl_operators.is_direct() << ")");
+      throw std::runtime_error("impl_batch is not supported with the configured implicit solver");
+    }
+    ML_CVLOG(3, this->get_logger_id(), "  batched implicit solves:     " << std::boolalpha << this->_impl_batch);
+  }
+
   template<class SweeperTrait, typename Enabled>
   void
   IMEX<SweeperTrait, Enabled>::setup()
@@ -89,11 +212,12 @@ namespace pfasst
     const typename traits::time_t dt = this->get_status()->get_dt();
 
     assert(this->get_quadrature() != nullptr);
-    auto nodes = this->get_quadrature()->get_nodes();
-    nodes.insert(nodes.begin(), typename traits::time_t(0.0));
-    const size_t num_nodes = this->get_quadrature()->get_num_nodes();
+    const auto& plan = this->sweep_plan();
+    const auto& times = plan.get_times();
+    const size_t num_nodes = plan.get_num_nodes();
 
-    this->_impl_rhs.front() = this->evaluate_rhs_impl(t, this->get_states().front());
+    this->evaluate_rhs_impl(t, this->get_states().front(), this->_impl_rhs.front());
+    this->rhs_evaluated(0);
 
     ML_CLOG(INFO, this->get_logger_id(),  "Predicting from t=" << t << " over " << num_nodes << " nodes"
                           << " to t=" << (t + dt) << " (dt=" << dt << ")");
@@ -101,8 +225,9 @@ namespace pfasst
 
     for (size_t m = 0; m < num_nodes; ++m) {
       this->states()[m + 1]->data() = this->states()[m]->data();
-      this->_impl_rhs[m + 1] = this->evaluate_rhs_impl(tm, this->get_states()[m + 1]);
-      tm += dt *  (nodes[m+1] - nodes[m]);
+      this->evaluate_rhs_impl(tm, this->get_states()[m + 1], this->_impl_rhs[m + 1]);
+      this->rhs_evaluated(m + 1);
+      tm = times[m + 1];
 
       ML_CVLOG(1, this->get_logger_id(), "");
 
@@ -136,30 +261,27 @@ namespace pfasst
 
 
 	
-    const typename traits::time_t dt = this->get_status()->get_dt();
-    const auto q_mat = this->get_quadrature()->get_q_mat();
-    auto nodes = this->get_quadrature()->get_nodes();
-    nodes.insert(nodes.begin(), typename traits::time_t(0.0));
-    const size_t num_nodes = this->get_quadrature()->get_num_nodes();
+    const auto& plan = this->sweep_plan();
+    const size_t num_nodes = plan.get_num_nodes();
 
     ML_CVLOG(4, this->get_logger_id(), "computing integrals");
     ML_CVLOG(6, this->get_logger_id(), "  q_int     = dt * Q * f_ex");
-    //this->_q_integrals = encap::mat_mul_vec(dt, q_mat, this->_expl_rhs);
+    //this->_q_integrals = encap::mat_mul_vec(1.0, plan.get_q_mat(), this->_expl_rhs);
     ML_CVLOG(6, this->get_logger_id(), "           += dt * Q * f_im");
-    encap::mat_apply(this->_q_integrals, dt, q_mat, this->_impl_rhs, true); //false
+    encap::mat_apply(this->_q_integrals, 1.0, plan.get_q_mat(), this->_impl_rhs, true, this->get_thread_pool());
 
     ML_CVLOG(4, this->get_logger_id(), "  subtracting function evaluations of previous iteration and adding FAS correction");
 
-
-    for (size_t m = 0; m < num_nodes; ++m) {
+    // each node only touches its own integral
+    parallel_for(this->get_thread_pool(), num_nodes, [&](const size_t m) {
       for (size_t n = 0; n < m + 1; ++n) {
-        this->_q_integrals[m + 1]->scaled_add(-dt * this->_q_delta_impl(m + 1, n + 1), this->_impl_rhs[n + 1]);
+        this->_q_integrals[m + 1]->scaled_add(-plan.get_q_delta_impl()(m + 1, n + 1), this->_impl_rhs[n + 1]);
       }
 
 //       ML_CVLOG(6, this->get_logger_id(), LOG_FLOAT << "  q_int["<<(m+1)<<"] += tau["<<(m+1)<<"]                  = "
 //                                        << to_string(this->get_tau()[m + 1]));
       this->_q_integrals[m + 1]->scaled_add(1.0, this->get_tau()[m + 1]);
-    }
+    });
 
 //     for (size_t m = 0; m < num_nodes + 1; ++m) {
 //       ML_CVLOG(5, this->get_logger_id(), LOG_FLOAT << "  q_int["<<m<<"] = " << to_string(this->_q_integrals[m]));
@@ -183,48 +305,45 @@ namespace pfasst
 
     const typename traits::time_t t = this->get_status()->get_time();
     const typename traits::time_t dt = this->get_status()->get_dt();
-    auto nodes = this->get_quadrature()->get_nodes();
-    nodes.insert(nodes.begin(), typename traits::time_t(0.0));
-    const size_t num_nodes = this->get_quadrature()->get_num_nodes();
+    auto& plan = this->sweep_plan();
+    const auto& times = plan.get_times();
+    const size_t num_nodes = plan.get_num_nodes();
 
     ML_CLOG(INFO, this->get_logger_id(), "Sweeping from t=" << t << " over " << num_nodes
                           << " nodes to t=" << (t + dt) << " (dt=" << dt << ")");
 
+    this->_impl_operators.set_step_width(dt);
+
+    if ((this->_node_pool || this->_impl_batch) && this->_q_delta_diagonal) {
+      this->sweep_nodes_parallel();
+      return;
+    }
+
     //this->_expl_rhs.front() = this->evaluate_rhs_expl(t, this->get_states().front());
 
     typename traits::time_t tm = t;
     // note: m=0 is initial value and not a quadrature node
     for (size_t m = 0; m < num_nodes; ++m) {
-      ML_CVLOG(4, this->get_logger_id(), "propagating from t["<<m<<"]=" << (t + (dt * nodes[m]))
-                                                   << " to t["<<(m+1)<<"]=" << (t + (dt * nodes[m+1])));
+      ML_CVLOG(4, this->get_logger_id(), "propagating from t["<<m<<"]=" << times[m]
+                                                   << " to t["<<(m+1)<<"]=" << times[m + 1]);
 //       ML_CVLOG(5, this->get_logger_id(), LOG_FLOAT << "  u["<<m<<"] = " << to_string(this->get_states()[m]));
 
       // compute right hand side for implicit solve (i.e. the explicit part of the propagation)
-      shared_ptr<typename traits::encap_t> rhs = this->get_encap_factory().create();
-      // rhs = u_0
-     
-      if (is_coarse){
-        rhs->data() =  this->_M_initial->get_data(); //   this->get_states().front()->get_data();
-
-          
-      }else{
-        M_dune.mv(this->get_states().front()->get_data(), rhs->data());
-        
-
-        
-      }
+      shared_ptr<typename traits::encap_t> rhs = plan.scratch()[m + 1];
+      // rhs = M * u_0
+      rhs->data() = this->M_initial_state()->get_data();
 //    
       
       //ML_CVLOG(6, this->get_logger_id(), "  rhs = u[0]                    = " << to_string(rhs));
 
       // rhs += dt * \sum_{i=0}^m (QI_{m+1,i} fI(u_i^{k+1}) + QE_{m+1,i-1} fE(u_{i-1}^{k+1}) ) + QE_{m+1,m} fE(u_{m}^{k+1})
       for (size_t n = 0; n <= m; ++n) {
-        rhs->scaled_add(dt * this->_q_delta_impl(m + 1, n), this->_impl_rhs[n]);
+        rhs->scaled_add(plan.get_q_delta_impl()(m + 1, n), this->_impl_rhs[n]);
 //         ML_CVLOG(6, this->get_logger_id(), "     += dt * QI_{"<<(m+1)<<","<<(n+1)<<"} * f_im["<<(n+1)<<"] = "
 //                             << LOG_FIXED << dt << " * " << this->_q_delta_impl(m + 1, n + 1) << " * "
 //                             << LOG_FLOAT << to_string(this->_impl_rhs[n]));
 
-        //rhs->scaled_add(dt * this->_q_delta_expl(m + 1, n), this->_expl_rhs[n]);
+        //rhs->scaled_add(plan.get_q_delta_expl()(m + 1, n), this->_expl_rhs[n]);
 //         ML_CVLOG(6, this->get_logger_id(), "     += dt * QE_{"<<(m+1)<<","<<n<<"} * f_ex["<<n<<"] = "
 //                             << LOG_FIXED << dt << " * " << this->_q_delta_expl(m + 1, n) << " * "
 //                             << LOG_FLOAT << to_string(this->_expl_rhs[n]));
@@ -239,7 +358,9 @@ namespace pfasst
 
       // solve the implicit part
       ML_CVLOG(4, this->get_logger_id(), "  solve(u["<<(m+1)<<"] - dt * QI_{"<<(m+1)<<","<<(m+1)<<"} * f_im["<<(m+1)<<"] = rhs)");
-      this->implicit_solve(this->_impl_rhs[m + 1], this->states()[m + 1], tm, dt * this->_q_delta_impl(m+1, m+1), rhs);
+      this->initial_guess(m + 1);
+      this->implicit_solve(this->_impl_rhs[m + 1], this->states()[m + 1], tm, plan.get_q_delta_impl()(m+1, m+1), rhs);
+      this->rhs_evaluated(m + 1);
 //       ML_CVLOG(5, this->get_logger_id(), "  u["<<(m+1)<<"] = " << to_string(this->get_states()[m + 1]));
 
       	/*std::cout <<  "sweeper nach imp solve " << std::endl;
@@ -248,10 +369,10 @@ namespace pfasst
         }*/
         //std::exit(0);
       // reevaluate the explicit part with the new solution value
-      tm += dt * this->_q_delta_impl(m+1, m+1);
+      tm += plan.get_q_delta_impl()(m+1, m+1);
       //this->_expl_rhs[m + 1] = this->evaluate_rhs_expl(tm, this->get_states()[m + 1]);
 
-//       ML_CVLOG(4, this->get_logger_id(), LOG_FIXED << "  ==> values at t["<<(m+1)<<"]=" << (t + (dt * nodes[m+1])));
+//       ML_CVLOG(4, this->get_logger_id(), LOG_FIXED << "  ==> values at t["<<(m+1)<<"]=" << times[m + 1]);
 //       ML_CVLOG(5, this->get_logger_id(), LOG_FLOAT << "         u["<<m+1<<"]: " << to_string(this->get_states()[m + 1]));
 //       ML_CVLOG(6, this->get_logger_id(), LOG_FLOAT << "      f_ex["<<m+1<<"]: " << to_string(this->_expl_rhs[m + 1]));
 //       ML_CVLOG(6, this->get_logger_id(), LOG_FLOAT << "      f_im["<<m+1<<"]: " << to_string(this->_impl_rhs[m + 1]));
@@ -259,6 +380,63 @@ namespace pfasst
     }
   }
 
+  template<class SweeperTrait, typename Enabled>
+  void
+  IMEX<SweeperTrait, Enabled>::sweep_nodes_parallel()
+  {
+    assert(this->_node_pool != nullptr || this->_impl_batch);
+    assert(this->_q_delta_diagonal);
+
+    auto& plan = this->sweep_plan();
+    const auto& times = plan.get_times();
+    const size_t num_nodes = plan.get_num_nodes();
+
+    const bool lockstep = this->_impl_batch && this->_impl_operators.can_batch();
+    ML_CVLOG_IF(lockstep, 4, this->get_logger_id(), "solving " << num_nodes << " nodes as one batch");
+    ML_CVLOG_IF(!lockstep, 4, this->get_logger_id(), "solving " << num_nodes << " nodes on "
+                                                     << (this->_node_pool ? this->_node_pool->size() : 1) << " threads");
+
+    // with a diagonal Q_delta the right hand sides only depend on the previous iterate
+    auto& rhs = plan.scratch();
+    const shared_ptr<typename traits::encap_t> uM0 = this->M_initial_state();
+    for (size_t m = 1; m < num_nodes + 1; ++m) {
+      rhs[m]->data() = uM0->get_data();
+      rhs[m]->scaled_add(1.0, this->_q_integrals[m]);
+    }
+
+    // initial_guess(m) may read the old iterate at m - 1, which must not be overwritten before
+    if (this->_initial_guess == initial_guess_t::PREVIOUS_NODE) {
+      for (size_t m = num_nodes; m > 0; --m) {
+        this->initial_guess(m);
+      }
+    } else {
+      for (size_t m = 1; m < num_nodes + 1; ++m) {
+        this->initial_guess(m);
+      }
+    }
+
+    if (this->_impl_batch) {
+      vector<typename traits::time_t> coeffs(num_nodes);
+      for (size_t m = 0; m < num_nodes; ++m) {
+        coeffs[m] = plan.get_q_delta_impl()(m + 1, m + 1);
+      }
+      this->implicit_solve_batch(vector<shared_ptr<typename traits::encap_t>>(this->_impl_rhs.begin() + 1, this->_impl_rhs.end()),
+                                 vector<shared_ptr<typename traits::encap_t>>(this->states().begin() + 1, this->states().end()),
+                                 vector<typename traits::time_t>(times.begin() + 1, times.end()),
+                                 coeffs,
+                                 vector<shared_ptr<typename traits::encap_t>>(rhs.begin() + 1, rhs.end()));
+    } else {
+      this->_node_pool->for_each(num_nodes, [&](const size_t m) {
+        this->implicit_solve(this->_impl_rhs[m + 1], this->states()[m + 1], times[m + 1],
+                             plan.get_q_delta_impl()(m + 1, m + 1), rhs[m + 1]);
+      });
+    }
+
+    for (size_t m = 1; m < num_nodes + 1; ++m) {
+      this->rhs_evaluated(m);
+    }
+  }
+
   template<class SweeperTrait, typename Enabled>
   void
   IMEX<SweeperTrait, Enabled>::post_sweep()
@@ -316,20 +494,30 @@ namespace pfasst
     if (initial_only) {
       assert( this->_impl_rhs.front() != nullptr);
 
-      //this->_expl_rhs.front() = this->evaluate_rhs_expl(t0, this->get_initial_state());
-      this->_impl_rhs.front() = this->evaluate_rhs_impl(t0, this->get_initial_state());
+      if (this->is_rhs_stale(0)) {
+        //this->_expl_rhs.front() = this->evaluate_rhs_expl(t0, this->get_initial_state());
+        this->evaluate_rhs_impl(t0, this->get_initial_state(), this->_impl_rhs.front());
+        this->rhs_evaluated(0);
+      } else {
+        this->_num_skipped_evaluations++;
+      }
 
     } else {
-      const typename traits::time_t dt = this->get_status()->get_dt();
-      auto nodes = this->get_quadrature()->get_nodes();
-      nodes.insert(nodes.begin(), 0.0);
+      const auto& times = this->sweep_plan().get_times();
 
       for (size_t m = 0; m < this->get_quadrature()->get_num_nodes() + 1; ++m) {
-        const typename traits::time_t t = t0 + dt * nodes[m];
+        const typename traits::time_t t = times[m];
         assert( this->_impl_rhs[m] != nullptr);
 
+        // states the last transfer left (almost) unchanged keep their evaluation
+        if (!this->is_rhs_stale(m)) {
+          this->_num_skipped_evaluations++;
+          continue;
+        }
+
         //this->_expl_rhs[m] = this->evaluate_rhs_expl(t, this->get_states()[m]);
-        this->_impl_rhs[m] = this->evaluate_rhs_impl(t, this->get_states()[m]);
+        this->evaluate_rhs_impl(t, this->get_states()[m], this->_impl_rhs[m]);
+        this->rhs_evaluated(m);
       }
     }
   }
@@ -345,7 +533,7 @@ namespace pfasst
   vector<shared_ptr<typename SweeperTrait::encap_t>>
   IMEX<SweeperTrait, Enabled>::integrate(const typename SweeperTrait::time_t& dt)
   {
-    auto const q_mat = this->get_quadrature()->get_q_mat();
+    const auto& q_mat = this->get_quadrature()->get_q_mat();
 
     //auto result = encap::mat_mul_vec(dt, q_mat, this->_expl_rhs);
     auto result = encap::mat_mul_vec(dt, q_mat, this->_impl_rhs);
@@ -360,7 +548,7 @@ namespace pfasst
   vector<shared_ptr<typename SweeperTrait::encap_t>>
   IMEX<SweeperTrait, Enabled>::integrate_new(const typename SweeperTrait::time_t& dt)
   {
-    auto const q_mat = this->get_quadrature()->get_q_mat();
+    const auto& q_mat = this->get_quadrature()->get_q_mat();
 
     //vector<shared_ptr<typename SweeperTrait::encap_t>>&
     
@@ -402,8 +590,8 @@ namespace pfasst
     assert(this->get_quadrature() != nullptr);
     assert(this->get_initial_state() != nullptr);
 
-    const typename traits::time_t dt = this->get_status()->get_dt();
     const size_t num_nodes = this->get_quadrature()->get_num_nodes() + 1;
+    const auto& plan = this->sweep_plan();
 
     if (only_last) {
       const size_t cols = this->get_quadrature()->get_q_mat().cols();
@@ -411,80 +599,35 @@ namespace pfasst
       
       
       
-      if (is_coarse){
-        this->residuals().back()->data() =  this->_M_initial->get_data(); //   this->get_states().front()->get_data();
-      }else{
-        M_dune.mv(this->get_initial_state()->get_data(), this->residuals().back()->data());
-      }
-      
-      //M_dune.mv(this->get_initial_state()->get_data(), this->residuals().back()->data());
-      //this->residuals().back()->data() = this->get_initial_state()->get_data();
-      
-      shared_ptr<typename traits::encap_t> uM = this->get_encap_factory().create();	
-      M_dune.mv(this->get_states().back()->get_data(), uM->data());
-      this->residuals().back()->scaled_add(-1.0, uM);	
-      //this->residuals()[m]->scaled_add(-1.0,uM);
-
-      
-      
+      this->residuals().back()->data() = this->M_initial_state()->get_data();
+      this->mass_mmv(this->get_states().back()->get_data(), this->residuals().back()->data());
       this->residuals().back()->scaled_add(1.0, this->get_tau().back());
       for (size_t n = 0; n < cols; ++n) {
-        //this->residuals().back()->scaled_add(dt * this->get_quadrature()->get_q_mat()(rows - 1, n), this->_expl_rhs[n]);
-        this->residuals().back()->scaled_add(dt * this->get_quadrature()->get_q_mat()(rows - 1, n), this->_impl_rhs[n]);
+        //this->residuals().back()->scaled_add(plan.get_q_mat()(rows - 1, n), this->_expl_rhs[n]);
+        this->residuals().back()->scaled_add(plan.get_q_mat()(rows - 1, n), this->_impl_rhs[n]);
       }
     } else {
-      for (size_t m = 0; m < num_nodes; ++m) {
+      // M * u_0 is the same for all nodes and cached across sweeps
+      const shared_ptr<typename traits::encap_t> uM0 = this->M_initial_state();
+
+      ML_CVLOG(5, this->get_logger_id(), "  res[m] = M * u[0] - M * u[m] + tau[m]");
+      parallel_for(this->get_thread_pool(), num_nodes, [&](const size_t m) {
         assert(this->get_states()[m] != nullptr);
         assert(this->residuals()[m] != nullptr);
-
-  //       ML_CVLOG(5, this->get_logger_id(), "  res["<<m<<"] = u[0]   = " << to_string(this->get_initial_state()));
-        //this->residuals()[m]->data() = this->get_initial_state()->get_data();
-	/*std::cout << "************* im fe_imex pointer *********************" << std::endl;	
-	for (int i=0; i< 2; i++){
-	  //std::cout <<  "A  " << this->A_dune[i][i] << std::endl;
-	  std::cout <<  "M  " << (M_dune)[i][i] << std::endl;
-        }
-	std::cout << "**********************************" << std::endl;	*/
-	
-    
-    if (is_coarse){
-        this->residuals()[m]->data() =  this->_M_initial->get_data(); //   this->get_states().front()->get_data();
-    }else{
-        M_dune.mv(this->get_initial_state()->get_data(), this->residuals()[m]->data());
-    }
-    
-	//M_dune.mv(this->get_initial_state()->get_data(), this->residuals()[m]->data());
-
-  //       ML_CVLOG(5, this->get_logger_id(), "        -= u["<<m<<"]   = " << to_string(this->get_states()[m]));
-	
-	shared_ptr<typename traits::encap_t> uM = this->get_encap_factory().create();
-	
-
-	M_dune.mv(this->get_states()[m]->get_data(), uM->data());
-
-	
-	this->residuals()[m]->scaled_add(-1.0,uM);
-        //this->residuals()[m]->scaled_add(-1.0, this->get_states()[m]);
-
         assert(this->get_tau()[m] != nullptr);
-  //       ML_CVLOG(5, this->get_logger_id(), "        += tau["<<m<<"] = " << to_string(this->get_tau()[m]));
-        this->residuals()[m]->scaled_add(1.0, this->get_tau()[m]);
-      }
 
-      //ML_CVLOG(5, this->get_logger_id(), "  res += dt * Q * F_ex");
-      //encap::mat_apply(this->residuals(), dt, this->get_quadrature()->get_q_mat(), this->_expl_rhs, false);
+        this->residuals()[m]->data() = uM0->get_data();
+        this->mass_mmv(this->get_states()[m]->get_data(), this->residuals()[m]->data());
+        this->residuals()[m]->scaled_add(1.0, this->get_tau()[m]);
+      });
 
       ML_CVLOG(5, this->get_logger_id(), "  res += dt * Q * F_im");
-      encap::mat_apply(this->residuals(), dt, this->get_quadrature()->get_q_mat(), this->_impl_rhs, false);
+      encap::mat_apply(this->residuals(), 1.0, plan.get_q_mat(), this->_impl_rhs, false, this->get_thread_pool());
 
       ML_CVLOG(5, this->get_logger_id(), "  ==>");
       for (size_t m = 0; m < num_nodes; ++m) {
-        //ML_CVLOG(5, this->get_logger_id(), "    |res["<<m<<"]| = " << LOG_FLOAT << this->get_residuals()[m]->norm0());
         ML_CVLOG(5, this->get_logger_id(), "    |res["<<m<<"]| = " << this->get_residuals()[m]->norm0());
-  //                                       << "    res["<<m<<"] = " << to_string(this->get_residuals()[m]));
-
       }
-      
     }
     //std::exit(0);
   }
@@ -521,15 +664,26 @@ namespace pfasst
     throw std::runtime_error("evaluation of explicit part of right-hand-side");
   }*/
 
+  template<class SweeperTrait, typename Enabled>
+  shared_ptr<typename SweeperTrait::encap_t>
+  IMEX<SweeperTrait, Enabled>::evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
+                                                 const shared_ptr<typename SweeperTrait::encap_t> u)
+  {
+    auto result = this->get_encap_factory().create();
+    this->evaluate_rhs_impl(t, u, result);
+    return result;
+  }
+
   /**
    * @throws std::runtime_error if not overwritten in specialized implementation
    */
   template<class SweeperTrait, typename Enabled>
-  shared_ptr<typename SweeperTrait::encap_t>
+  void
   IMEX<SweeperTrait, Enabled>::evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
-                                                 const shared_ptr<typename SweeperTrait::encap_t> u)
+                                                 const shared_ptr<typename SweeperTrait::encap_t> u,
+                                                 shared_ptr<typename SweeperTrait::encap_t> result)
   {
-    UNUSED(t); UNUSED(u);
+    UNUSED(t); UNUSED(u); UNUSED(result);
     throw std::runtime_error("evaluation of implicit part of right-hand-side");
   }
 
@@ -548,6 +702,73 @@ namespace pfasst
     throw std::runtime_error("spatial solver");
   }
 
+  template<class SweeperTrait, typename Enabled>
+  void
+  IMEX<SweeperTrait, Enabled>::implicit_solve_batch(const vector<shared_ptr<typename SweeperTrait::encap_t>>& f,
+                                                    const vector<shared_ptr<typename SweeperTrait::encap_t>>& u,
+                                                    const vector<typename SweeperTrait::time_t>& t,
+                                                    const vector<typename SweeperTrait::time_t>& dt,
+                                                    const vector<shared_ptr<typename SweeperTrait::encap_t>>& rhs)
+  {
+    assert(u.size() == f.size() && t.size() == f.size() && dt.size() == f.size() && rhs.size() == f.size());
+
+    auto solve = [&](const size_t k) {
+      this->implicit_solve(f[k], u[k], t[k], dt[k], rhs[k]);
+    };
+
+    if (this->_node_pool) {
+      this->_node_pool->for_each(f.size(), solve);
+    } else {
+      for (size_t k = 0; k < f.size(); ++k) {
+        solve(k);
+      }
+    }
+  }
+
+  template<class SweeperTrait, typename Enabled>
+  void
+  IMEX<SweeperTrait, Enabled>::initial_guess(const size_t m)
+  {
+    assert(m > 0 && m < this->get_states().size());
+
+    switch (this->_initial_guess) {
+      case initial_guess_t::ZERO:
+        this->states()[m]->zero();
+        break;
+
+      case initial_guess_t::PREVIOUS_ITERATE:
+        // states()[m] still holds the last iterate
+        break;
+
+      case initial_guess_t::PREVIOUS_NODE:
+        this->states()[m]->data() = this->get_states()[m - 1]->get_data();
+        break;
+
+      case initial_guess_t::EXTRAPOLATE: {
+        const auto t = this->get_status()->get_time();
+        if (this->_guess_history.size() != this->get_states().size()) {
+          this->_guess_history = this->create_nodes(this->get_states().size());
+        }
+        if (m == 1 && this->_guess_history_time != t) {
+          // new time step: the history holds iterates of the previous one
+          this->_guess_history_time = std::numeric_limits<typename traits::time_t>::quiet_NaN();
+        }
+
+        auto current = this->get_encap_factory().create_uninitialized();
+        current->data() = this->get_states()[m]->get_data();
+        if (this->_guess_history_time == t) {
+          this->states()[m]->axpby(-1.0, this->_guess_history[m], 2.0);
+        }
+        this->_guess_history[m]->data() = current->get_data();
+
+        if (m == this->get_states().size() - 1) {
+          this->_guess_history_time = t;
+        }
+        break;
+      }
+    }
+  }
+
   template<class SweeperTrait, typename Enabled>
   void
   IMEX<SweeperTrait, Enabled>::compute_delta_matrices()
@@ -568,8 +789,7 @@ namespace pfasst
     this->_q_delta_expl = Matrix<typename traits::time_t>::Zero(num_nodes + 1, num_nodes + 1);
     this->_q_delta_impl = Matrix<typename traits::time_t>::Zero(num_nodes + 1, num_nodes + 1);
 
-    bool lr=true;
-    if(lr){
+    if (this->_q_delta_type == q_delta_t::LU) {
         auto const q_mat = this->get_quadrature()->get_q_mat();
 
 
@@ -634,7 +854,7 @@ namespace pfasst
 
 
 
-    }else{
+    } else if (this->_q_delta_type == q_delta_t::IMPLICIT_EULER) {
 
 
 
@@ -646,6 +866,20 @@ namespace pfasst
         }
 
 
+    } else {
+      // MIN-SR-NS: diagonal with tau_m / M, which makes I - Q_delta^{-1} Q nilpotent for non-stiff problems
+      for (size_t m = 1; m < num_nodes + 1; ++m) {
+        this->_q_delta_impl(m, m) = nodes[m] / typename traits::time_t(num_nodes);
+      }
+    }
+
+    this->_q_delta_diagonal = true;
+    for (size_t m = 1; m < num_nodes + 1; ++m) {
+      for (size_t n = 0; n < m; ++n) {
+        if (this->_q_delta_impl(m, n) != 0.0) {
+          this->_q_delta_diagonal = false;
+        }
+      }
     }
 
     ML_CVLOG(5, this->get_logger_id(), "QE:");
@@ -659,5 +893,7 @@ namespace pfasst
       ML_CVLOG(5, this->get_logger_id(),
                "  " << this->_q_delta_impl.block(row, 0, 1, this->_q_delta_impl.cols()));
     }
+
+    this->_plan.set_delta_matrices(this->_q_delta_impl, this->_q_delta_expl);
   }
 }  // ::pfasst
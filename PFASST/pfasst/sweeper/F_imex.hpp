@@ -114,21 +114,47 @@ namespace pfasst
       /**
        * Evaluation of the explicit part of the problem equation's right hand side: @f$ F_E(\vec{u}, t) @f$.
        *
+       * Convenience wrapper around the in-place version allocating a new Encapsulation for the
+       * result.
+       *
        * @param[in] t  time point to evaluate @f$ F_E(\vec{u},t) @f$ at
        * @param[in] u  spatial data to be passed to @f$ F_E(\vec{u},t) @f$
        * @returns spatial values of function evaluation
        */
       virtual shared_ptr<typename SweeperTrait::encap_t> evaluate_rhs_expl(const typename SweeperTrait::time_t& t,
                                                                            const shared_ptr<typename SweeperTrait::encap_t> u);
+      /**
+       * In-place evaluation of the explicit part of the problem equation's right hand side.
+       *
+       * @param[in]  t       time point to evaluate @f$ F_E(\vec{u},t) @f$ at
+       * @param[in]  u       spatial data to be passed to @f$ F_E(\vec{u},t) @f$
+       * @param[out] result  spatial values of function evaluation; must not be the same as @p u
+       */
+      virtual void evaluate_rhs_expl(const typename SweeperTrait::time_t& t,
+                                     const shared_ptr<typename SweeperTrait::encap_t> u,
+                                     shared_ptr<typename SweeperTrait::encap_t> result);
       /**
        * Evaluation of the implicit part of the problem equation's right hand side: @f$ F_I(\vec{u}, t) @f$.
        *
+       * Convenience wrapper around the in-place version allocating a new Encapsulation for the
+       * result.
+       *
        * @param[in] t  time point to evaluate @f$ F_I(\vec{u},t) @f$ at
        * @param[in] u  spatial data to be passed to @f$ F_I(\vec{u},t) @f$
        * @returns spatial values of function evaluation
        */
       virtual shared_ptr<typename SweeperTrait::encap_t> evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
                                                                            const shared_ptr<typename SweeperTrait::encap_t> u);
+      /**
+       * In-place evaluation of the implicit part of the problem equation's right hand side.
+       *
+       * @param[in]  t       time point to evaluate @f$ F_I(\vec{u},t) @f$ at
+       * @param[in]  u       spatial data to be passed to @f$ F_I(\vec{u},t) @f$
+       * @param[out] result  spatial values of function evaluation; must not be the same as @p u
+       */
+      virtual void evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
+                                     const shared_ptr<typename SweeperTrait::encap_t> u,
+                                     shared_ptr<typename SweeperTrait::encap_t> result);
       /**
        * Implicitly solving the implicit SDC equation.
        *
@@ -271,6 +297,9 @@ namespace pfasst
       //! @}
       
       
+      //! @f$ y = M x @f$, e.g. for the FAS corrections of the transfer
+      void mass_mv(const VectorType& x, VectorType& y) const { M_dune.mv(x, y); }
+
       shared_ptr<MatrixType> get_M_dune(){return make_shared<MatrixType>(M_dune);};
       shared_ptr<MatrixType> get_A_dune() {return make_shared<MatrixType>(A_dune);};
   };
@@ -36,17 +36,11 @@ namespace pfasst
     const auto num_nodes = this->get_quadrature()->get_num_nodes();
     assert(this->get_states().size() == num_nodes + 1);
 
-    this->_q_integrals.resize(num_nodes + 1);
-    std::generate(this->_q_integrals.begin(), this->_q_integrals.end(),
-             std::bind(&traits::encap_t::factory_t::create, this->encap_factory()));
+    this->_q_integrals = this->create_nodes(num_nodes + 1);
 
-    this->_expl_rhs.resize(num_nodes + 1);
-    std::generate(this->_expl_rhs.begin(), this->_expl_rhs.end(),
-             std::bind(&traits::encap_t::factory_t::create, this->encap_factory()));
+    this->_expl_rhs = this->create_nodes(num_nodes + 1);
 
-    this->_impl_rhs.resize(num_nodes + 1);
-    std::generate(this->_impl_rhs.begin(), this->_impl_rhs.end(),
-             std::bind(&traits::encap_t::factory_t::create, this->encap_factory()));
+    this->_impl_rhs = this->create_nodes(num_nodes + 1);
 
     this->compute_delta_matrices();
   }
@@ -106,29 +100,29 @@ namespace pfasst
     const typename traits::time_t dt = this->get_status()->get_dt();
 
     assert(this->get_quadrature() != nullptr);
-    auto nodes = this->get_quadrature()->get_nodes();
-    nodes.insert(nodes.begin(), typename traits::time_t(0.0));
-    const size_t num_nodes = this->get_quadrature()->get_num_nodes();
+    auto& plan = this->sweep_plan();
+    const auto& times = plan.get_times();
+    const size_t num_nodes = plan.get_num_nodes();
 
-    this->_expl_rhs.front() = this->evaluate_rhs_expl(t, this->get_states().front());
+    this->evaluate_rhs_expl(t, this->get_states().front(), this->_expl_rhs.front());
 
     ML_CLOG(INFO, this->get_logger_id(), "Predicting from t=" << t << " over " << num_nodes << " nodes"
                           << " to t=" << (t + dt) << " (dt=" << dt << ")");
 
     typename traits::time_t tm = t;
     for (size_t m = 0; m < num_nodes; ++m) {
-      ML_CVLOG(1, this->get_logger_id(), "propagating from t["<<m<<"]=" << dt << " * " << nodes[m]
-                          << " to t["<<(m+1)<<"]=" << dt << " * " << nodes[m+1]);
+      ML_CVLOG(1, this->get_logger_id(), "propagating from t["<<m<<"]=" << times[m]
+                          << " to t["<<(m+1)<<"]=" << times[m + 1]);
 //       ML_CVLOG(2, this->get_logger_id(), LOG_FLOAT << "  u["<<m<<"] = " << to_string(this->get_states()[m]));
 
       // compute right hand side for implicit solve (i.e. the explicit part of the propagation)
-      shared_ptr<typename traits::encap_t> rhs = this->get_encap_factory().create();
+      shared_ptr<typename traits::encap_t> rhs = plan.scratch()[m + 1];
       //std::cout << "vor mv" << std::endl;
       M_dune.mv(this->get_states()[m]->get_data(), rhs->data());
       //std::cout << "nach mv" << std::endl;
       //rhs->data() = this->get_states()[m]->get_data();
 //       ML_CVLOG(2, this->get_logger_id(), "  rhs = u["<<m<<"]                    = " << to_string(rhs));
-      rhs->scaled_add(dt * this->_q_delta_expl(m + 1, m), this->_expl_rhs[m]);
+      rhs->scaled_add(plan.get_q_delta_expl()(m + 1, m), this->_expl_rhs[m]);
 //       ML_CVLOG(2, this->get_logger_id(), "     += dt * QE_{"<<(m+1)<<","<<m<<"} * f_ex["<<m<<"] = "
 //                           << LOG_FIXED << dt << " * " << this->_q_delta_expl(m + 1, m) << " * "
 //                           << LOG_FLOAT << to_string(this->_expl_rhs[m]));
@@ -138,7 +132,7 @@ namespace pfasst
       ML_CVLOG(2, this->get_logger_id(), "  solve(u["<<(m+1)<<"] - dt * QI_{"<<(m+1)<<","<<(m+1)<<"} * f_im["<<(m+1)<<"] = rhs)");
       //afangswert setzen
       this->states()[m + 1]->data() = this->states()[m + 1]->get_data();
-      this->implicit_solve(this->_impl_rhs[m + 1], this->states()[m + 1], tm, dt * this->_q_delta_impl(m + 1, m + 1), rhs);
+      this->implicit_solve(this->_impl_rhs[m + 1], this->states()[m + 1], tm, plan.get_q_delta_impl()(m + 1, m + 1), rhs);
 //       ML_CVLOG(2, this->get_logger_id(), "  u["<<(m+1)<<"] = " << to_string(this->get_states()[m + 1]));
     	/*std::cout <<  "predict nach impl solve" << std::endl;
         for (int i=0; i< this->get_end_state()->data().size(); i++){
@@ -147,8 +141,9 @@ namespace pfasst
 
 
       // reevaluate the explicit part with the new solution value
-      tm += dt * this->_q_delta_expl(m + 1, m);
-      this->_expl_rhs[m + 1] = this->evaluate_rhs_expl(tm, this->get_states()[m + 1]);
+      tm += plan.get_q_delta_expl()(m + 1, m);
+      this->evaluate_rhs_expl(tm, this->get_states()[m + 1], this->_expl_rhs[m + 1]);
+      this->rhs_evaluated(m + 1);
 
 //       ML_CVLOG(1, this->get_logger_id(), LOG_FIXED << "  ==> values at t["<<(m+1)<<"]=" << (dt * nodes[m+1]));
 //       ML_CVLOG(1, this->get_logger_id(), LOG_FLOAT << "         u["<<m+1<<"]: " << to_string(this->get_states()[m + 1]));
@@ -194,11 +189,8 @@ namespace pfasst
 
 
 	
-    const typename traits::time_t dt = this->get_status()->get_dt();
-    const auto q_mat = this->get_quadrature()->get_q_mat();
-    auto nodes = this->get_quadrature()->get_nodes();
-    nodes.insert(nodes.begin(), typename traits::time_t(0.0));
-    const size_t num_nodes = this->get_quadrature()->get_num_nodes();
+    const auto& plan = this->sweep_plan();
+    const size_t num_nodes = plan.get_num_nodes();
 
 //     ML_CVLOG(2, this->get_logger_id(), "initial values for sweeping");
 //     for (size_t m = 0; m <= num_nodes; ++m) {
@@ -210,9 +202,9 @@ namespace pfasst
 
     ML_CVLOG(4, this->get_logger_id(), "computing integrals");
     ML_CVLOG(6, this->get_logger_id(), "  q_int     = dt * Q * f_ex");
-    this->_q_integrals = encap::mat_mul_vec(dt, q_mat, this->_expl_rhs);
+    encap::mat_apply(this->_q_integrals, 1.0, plan.get_q_mat(), this->_expl_rhs, true);
     ML_CVLOG(6, this->get_logger_id(), "           += dt * Q * f_im");
-    encap::mat_apply(this->_q_integrals, dt, q_mat, this->_impl_rhs, false);
+    encap::mat_apply(this->_q_integrals, 1.0, plan.get_q_mat(), this->_impl_rhs, false);
 
     ML_CVLOG(4, this->get_logger_id(), "  subtracting function evaluations of previous iteration and adding FAS correction");
 
@@ -224,12 +216,12 @@ namespace pfasst
 //         ML_CVLOG(6, this->get_logger_id(), LOG_FIXED << "  q_int["<<m<<"] -= dt * QE_{"<<(m+1)<<","<<n<<"} * f_ex["<<n<<"] = "
 //                                          << -dt << " * " << this->_q_delta_expl(m + 1, n) << " * "
 //                                          << LOG_FLOAT << to_string(this->_expl_rhs[n]));
-        this->_q_integrals[m + 1]->scaled_add(-dt * this->_q_delta_expl(m + 1, n), this->_expl_rhs[n]);
 
 //         ML_CVLOG(6, this->get_logger_id(), LOG_FIXED << "  q_int["<<(m+1)<<"] -= dt * QI_{"<<(m+1)<<","<<(n+1)<<"} * f_im["<<(n+1)<<"] = "
 //                                          << -dt << " * " << this->_q_delta_impl(m + 1, n + 1) << " * "
 //                                          << LOG_FLOAT << to_string(this->_impl_rhs[n+1]));
-        this->_q_integrals[m + 1]->scaled_add(-dt * this->_q_delta_impl(m + 1, n + 1), this->_impl_rhs[n + 1]);
+        this->_q_integrals[m + 1]->scaled_add(-plan.get_q_delta_expl()(m + 1, n), this->_expl_rhs[n],
+                                              -plan.get_q_delta_impl()(m + 1, n + 1), this->_impl_rhs[n + 1]);
       }
 
 //       ML_CVLOG(6, this->get_logger_id(), LOG_FLOAT << "  q_int["<<(m+1)<<"] += tau["<<(m+1)<<"]                  = "
@@ -264,24 +256,24 @@ namespace pfasst
 
     const typename traits::time_t t = this->get_status()->get_time();
     const typename traits::time_t dt = this->get_status()->get_dt();
-    auto nodes = this->get_quadrature()->get_nodes();
-    nodes.insert(nodes.begin(), typename traits::time_t(0.0));
-    const size_t num_nodes = this->get_quadrature()->get_num_nodes();
+    auto& plan = this->sweep_plan();
+    const auto& times = plan.get_times();
+    const size_t num_nodes = plan.get_num_nodes();
 
     ML_CLOG(INFO, this->get_logger_id(), "Sweeping from t=" << t << " over " << num_nodes
                           << " nodes to t=" << (t + dt) << " (dt=" << dt << ")");
 
-    this->_expl_rhs.front() = this->evaluate_rhs_expl(t, this->get_states().front());
+    this->evaluate_rhs_expl(t, this->get_states().front(), this->_expl_rhs.front());
 
     typename traits::time_t tm = t;
     // note: m=0 is initial value and not a quadrature node
     for (size_t m = 0; m < num_nodes; ++m) {
-      ML_CVLOG(4, this->get_logger_id(), "propagating from t["<<m<<"]=" << (t + (dt * nodes[m]))
-                                                   << " to t["<<(m+1)<<"]=" << (t + (dt * nodes[m+1])));
+      ML_CVLOG(4, this->get_logger_id(), "propagating from t["<<m<<"]=" << times[m]
+                                                   << " to t["<<(m+1)<<"]=" << times[m + 1]);
 //       ML_CVLOG(5, this->get_logger_id(), LOG_FLOAT << "  u["<<m<<"] = " << to_string(this->get_states()[m]));
 
       // compute right hand side for implicit solve (i.e. the explicit part of the propagation)
-      shared_ptr<typename traits::encap_t> rhs = this->get_encap_factory().create();
+      shared_ptr<typename traits::encap_t> rhs = plan.scratch()[m + 1];
       // rhs = u_0
      
       M_dune.mv(this->get_states().front()->get_data(), rhs->data());
@@ -290,12 +282,12 @@ namespace pfasst
 
       // rhs += dt * \sum_{i=0}^m (QI_{m+1,i} fI(u_i^{k+1}) + QE_{m+1,i-1} fE(u_{i-1}^{k+1}) ) + QE_{m+1,m} fE(u_{m}^{k+1})
       for (size_t n = 0; n <= m; ++n) {
-        rhs->scaled_add(dt * this->_q_delta_impl(m + 1, n), this->_impl_rhs[n]);
+        rhs->scaled_add(plan.get_q_delta_impl()(m + 1, n), this->_impl_rhs[n],
+                        plan.get_q_delta_expl()(m + 1, n), this->_expl_rhs[n]);
 //         ML_CVLOG(6, this->get_logger_id(), "     += dt * QI_{"<<(m+1)<<","<<(n+1)<<"} * f_im["<<(n+1)<<"] = "
 //                             << LOG_FIXED << dt << " * " << this->_q_delta_impl(m + 1, n + 1) << " * "
 //                             << LOG_FLOAT << to_string(this->_impl_rhs[n]));
 
-        rhs->scaled_add(dt * this->_q_delta_expl(m + 1, n), this->_expl_rhs[n]);
 //         ML_CVLOG(6, this->get_logger_id(), "     += dt * QE_{"<<(m+1)<<","<<n<<"} * f_ex["<<n<<"] = "
 //                             << LOG_FIXED << dt << " * " << this->_q_delta_expl(m + 1, n) << " * "
 //                             << LOG_FLOAT << to_string(this->_expl_rhs[n]));
@@ -312,7 +304,7 @@ namespace pfasst
       ML_CVLOG(4, this->get_logger_id(), "  solve(u["<<(m+1)<<"] - dt * QI_{"<<(m+1)<<","<<(m+1)<<"} * f_im["<<(m+1)<<"] = rhs)");
       //afangswert setzen
       this->states()[m + 1]->data() = this->states()[m + 1]->get_data();
-      this->implicit_solve(this->_impl_rhs[m + 1], this->states()[m + 1], tm, dt * this->_q_delta_impl(m+1, m+1), rhs);
+      this->implicit_solve(this->_impl_rhs[m + 1], this->states()[m + 1], tm, plan.get_q_delta_impl()(m+1, m+1), rhs);
 //       ML_CVLOG(5, this->get_logger_id(), "  u["<<(m+1)<<"] = " << to_string(this->get_states()[m + 1]));
 
       	/*std::cout <<  "sweeper nach imp solve " << std::endl;
@@ -321,10 +313,11 @@ namespace pfasst
         }*/
         //std::exit(0);
       // reevaluate the explicit part with the new solution value
-      tm += dt * this->_q_delta_impl(m+1, m+1);
-      this->_expl_rhs[m + 1] = this->evaluate_rhs_expl(tm, this->get_states()[m + 1]);
+      tm += plan.get_q_delta_impl()(m+1, m+1);
+      this->evaluate_rhs_expl(tm, this->get_states()[m + 1], this->_expl_rhs[m + 1]);
+      this->rhs_evaluated(m + 1);
 
-//       ML_CVLOG(4, this->get_logger_id(), LOG_FIXED << "  ==> values at t["<<(m+1)<<"]=" << (t + (dt * nodes[m+1])));
+//       ML_CVLOG(4, this->get_logger_id(), LOG_FIXED << "  ==> values at t["<<(m+1)<<"]=" << times[m + 1]);
 //       ML_CVLOG(5, this->get_logger_id(), LOG_FLOAT << "         u["<<m+1<<"]: " << to_string(this->get_states()[m + 1]));
 //       ML_CVLOG(6, this->get_logger_id(), LOG_FLOAT << "      f_ex["<<m+1<<"]: " << to_string(this->_expl_rhs[m + 1]));
 //       ML_CVLOG(6, this->get_logger_id(), LOG_FLOAT << "      f_im["<<m+1<<"]: " << to_string(this->_impl_rhs[m + 1]));
@@ -389,20 +382,30 @@ namespace pfasst
     if (initial_only) {
       assert(this->_expl_rhs.front() != nullptr && this->_impl_rhs.front() != nullptr);
 
-      this->_expl_rhs.front() = this->evaluate_rhs_expl(t0, this->get_initial_state());
-      this->_impl_rhs.front() = this->evaluate_rhs_impl(t0, this->get_initial_state());
+      if (this->is_rhs_stale(0)) {
+        this->evaluate_rhs_expl(t0, this->get_initial_state(), this->_expl_rhs.front());
+        this->evaluate_rhs_impl(t0, this->get_initial_state(), this->_impl_rhs.front());
+        this->rhs_evaluated(0);
+      } else {
+        this->_num_skipped_evaluations++;
+      }
 
     } else {
-      const typename traits::time_t dt = this->get_status()->get_dt();
-      auto nodes = this->get_quadrature()->get_nodes();
-      nodes.insert(nodes.begin(), 0.0);
+      const auto& times = this->sweep_plan().get_times();
 
       for (size_t m = 0; m < this->get_quadrature()->get_num_nodes() + 1; ++m) {
-        const typename traits::time_t t = t0 + dt * nodes[m];
+        const typename traits::time_t t = times[m];
         assert(this->_expl_rhs[m] != nullptr && this->_impl_rhs[m] != nullptr);
 
-        this->_expl_rhs[m] = this->evaluate_rhs_expl(t, this->get_states()[m]);
-        this->_impl_rhs[m] = this->evaluate_rhs_impl(t, this->get_states()[m]);
+        // states the last transfer left (almost) unchanged keep their evaluation
+        if (!this->is_rhs_stale(m)) {
+          this->_num_skipped_evaluations++;
+          continue;
+        }
+
+        this->evaluate_rhs_expl(t, this->get_states()[m], this->_expl_rhs[m]);
+        this->evaluate_rhs_impl(t, this->get_states()[m], this->_impl_rhs[m]);
+        this->rhs_evaluated(m);
       }
     }
   }
@@ -418,7 +421,7 @@ namespace pfasst
   vector<shared_ptr<typename SweeperTrait::encap_t>>
   IMEX<SweeperTrait, Enabled>::integrate(const typename SweeperTrait::time_t& dt)
   {
-    auto const q_mat = this->get_quadrature()->get_q_mat();
+    const auto& q_mat = this->get_quadrature()->get_q_mat();
 
     auto result = encap::mat_mul_vec(dt, q_mat, this->_expl_rhs);
     encap::mat_apply(result, dt, q_mat, this->_impl_rhs, false);
@@ -455,8 +458,8 @@ namespace pfasst
     assert(this->get_quadrature() != nullptr);
     assert(this->get_initial_state() != nullptr);
 
-    const typename traits::time_t dt = this->get_status()->get_dt();
     const size_t num_nodes = this->get_quadrature()->get_num_nodes() + 1;
+    auto& plan = this->sweep_plan();
 
     if (only_last) {
       const size_t cols = this->get_quadrature()->get_q_mat().cols();
@@ -465,17 +468,16 @@ namespace pfasst
       M_dune.mv(this->get_initial_state()->get_data(), this->residuals().back()->data());
       //this->residuals().back()->data() = this->get_initial_state()->get_data();
       
-      shared_ptr<typename traits::encap_t> uM = this->get_encap_factory().create();	
+      shared_ptr<typename traits::encap_t> uM = plan.scratch().back();
       M_dune.mv(this->get_states().back()->get_data(), uM->data());
-      this->residuals().back()->scaled_add(-1.0, uM);	
       //this->residuals()[m]->scaled_add(-1.0,uM);
 
       
       
-      this->residuals().back()->scaled_add(1.0, this->get_tau().back());
+      this->residuals().back()->scaled_add(-1.0, uM, 1.0, this->get_tau().back());
       for (size_t n = 0; n < cols; ++n) {
-        this->residuals().back()->scaled_add(dt * this->get_quadrature()->get_q_mat()(rows - 1, n), this->_expl_rhs[n]);
-        this->residuals().back()->scaled_add(dt * this->get_quadrature()->get_q_mat()(rows - 1, n), this->_impl_rhs[n]);
+        this->residuals().back()->scaled_add(plan.get_q_mat()(rows - 1, n), this->_expl_rhs[n],
+                                             plan.get_q_mat()(rows - 1, n), this->_impl_rhs[n]);
       }
     } else {
       for (size_t m = 0; m < num_nodes; ++m) {
@@ -495,7 +497,7 @@ namespace pfasst
 
   //       ML_CVLOG(5, this->get_logger_id(), "        -= u["<<m<<"]   = " << to_string(this->get_states()[m]));
 	
-	shared_ptr<typename traits::encap_t> uM = this->get_encap_factory().create();
+	shared_ptr<typename traits::encap_t> uM = plan.scratch()[m];
 	
 	/*std::cout <<  "u " << std::endl;
         for (int i=0; i< this->get_end_state()->data().size(); i++){
@@ -508,19 +510,18 @@ namespace pfasst
         
         std::exit(0);*/
 	
-	this->residuals()[m]->scaled_add(-1.0,uM);
         //this->residuals()[m]->scaled_add(-1.0, this->get_states()[m]);
 
         assert(this->get_tau()[m] != nullptr);
   //       ML_CVLOG(5, this->get_logger_id(), "        += tau["<<m<<"] = " << to_string(this->get_tau()[m]));
-        this->residuals()[m]->scaled_add(1.0, this->get_tau()[m]);
+        this->residuals()[m]->scaled_add(-1.0, uM, 1.0, this->get_tau()[m]);
       }
 
       ML_CVLOG(5, this->get_logger_id(), "  res += dt * Q * F_ex");
-      encap::mat_apply(this->residuals(), dt, this->get_quadrature()->get_q_mat(), this->_expl_rhs, false);
+      encap::mat_apply(this->residuals(), 1.0, plan.get_q_mat(), this->_expl_rhs, false);
 
       ML_CVLOG(5, this->get_logger_id(), "  res += dt * Q * F_im");
-      encap::mat_apply(this->residuals(), dt, this->get_quadrature()->get_q_mat(), this->_impl_rhs, false);
+      encap::mat_apply(this->residuals(), 1.0, plan.get_q_mat(), this->_impl_rhs, false);
 
       ML_CVLOG(5, this->get_logger_id(), "  ==>");
       for (size_t m = 0; m < num_nodes; ++m) {
@@ -555,27 +556,49 @@ namespace pfasst
     this->compute_residuals(false);
   }
 
-  /**
-   * @throws std::runtime_error if not overwritten in specialized implementation
-   */
   template<class SweeperTrait, typename Enabled>
   shared_ptr<typename SweeperTrait::encap_t>
   IMEX<SweeperTrait, Enabled>::evaluate_rhs_expl(const typename SweeperTrait::time_t& t,
                                                  const shared_ptr<typename SweeperTrait::encap_t> u)
   {
-    UNUSED(t); UNUSED(u);
-    throw std::runtime_error("evaluation of explicit part of right-hand-side");
+    auto result = this->get_encap_factory().create();
+    this->evaluate_rhs_expl(t, u, result);
+    return result;
   }
 
   /**
    * @throws std::runtime_error if not overwritten in specialized implementation
    */
+  template<class SweeperTrait, typename Enabled>
+  void
+  IMEX<SweeperTrait, Enabled>::evaluate_rhs_expl(const typename SweeperTrait::time_t& t,
+                                                 const shared_ptr<typename SweeperTrait::encap_t> u,
+                                                 shared_ptr<typename SweeperTrait::encap_t> result)
+  {
+    UNUSED(t); UNUSED(u); UNUSED(result);
+    throw std::runtime_error("evaluation of explicit part of right-hand-side");
+  }
+
   template<class SweeperTrait, typename Enabled>
   shared_ptr<typename SweeperTrait::encap_t>
   IMEX<SweeperTrait, Enabled>::evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
                                                  const shared_ptr<typename SweeperTrait::encap_t> u)
   {
-    UNUSED(t); UNUSED(u);
+    auto result = this->get_encap_factory().create();
+    this->evaluate_rhs_impl(t, u, result);
+    return result;
+  }
+
+  /**
+   * @throws std::runtime_error if not overwritten in specialized implementation
+   */
+  template<class SweeperTrait, typename Enabled>
+  void
+  IMEX<SweeperTrait, Enabled>::evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
+                                                 const shared_ptr<typename SweeperTrait::encap_t> u,
+                                                 shared_ptr<typename SweeperTrait::encap_t> result)
+  {
+    UNUSED(t); UNUSED(u); UNUSED(result);
     throw std::runtime_error("evaluation of implicit part of right-hand-side");
   }
 
@@ -705,5 +728,7 @@ namespace pfasst
       ML_CVLOG(5, this->get_logger_id(),
                "  " << this->_q_delta_impl.block(row, 0, 1, this->_q_delta_impl.cols()));
     }
+
+    this->_plan.set_delta_matrices(this->_q_delta_impl, this->_q_delta_expl);
   }
 }  // ::pfasst
@@ -84,6 +84,14 @@ namespace pfasst
       //! Cache for the implicit function evaluations @f$ F_I(\vec{u}_n, t_n) @f$.
       vector<shared_ptr<typename traits::encap_t>> _impl_rhs;
       vector<shared_ptr<typename traits::encap_t>> _impl_rhs_restrict;
+      /**
+       * Cache for @f$ M \vec{u}_0 @f$ used by the sweeps and the residuals.
+       *
+       * Valid as long as `_M_u0_version` matches the version of the initial state, i.e. only recomputed
+       * after `initial_state()` was changed by `advance()`, the transfer or the communicator.
+       */
+      shared_ptr<typename traits::encap_t>         _M_u0;
+      size_t                                       _M_u0_version;
       
 
       //! Counter for total number of @f$ F_E(\vec{u},t) @f$ evaluations.
@@ -92,6 +100,27 @@ namespace pfasst
       size_t _num_impl_f_evals;
       //! Counter for total number of implicit solves.
       size_t _num_impl_solves;
+      /**
+       * Initial guess of the implicit solves.
+       *
+       * Set via the runtime parameter `initial_guess` (`zero`, `previous_iterate`, `previous_node` or
+       * `extrapolate`).
+       */
+      enum class initial_guess_t {
+        //! start from zero
+        ZERO,
+        //! start from the last iterate @f$ \vec{u}_{m+1}^k @f$ at the same node (or the prediction)
+        PREVIOUS_ITERATE,
+        //! start from the new iterate @f$ \vec{u}_m^{k+1} @f$ at the previous node
+        PREVIOUS_NODE,
+        //! start from the linear extrapolation @f$ 2 \vec{u}_{m+1}^k - \vec{u}_{m+1}^{k-1} @f$
+        EXTRAPOLATE
+      };
+      initial_guess_t                              _initial_guess;
+      //! Iterates @f$ \vec{u}^{k-1} @f$ of the current time step for `initial_guess_t::EXTRAPOLATE`.
+      vector<shared_ptr<typename traits::encap_t>> _guess_history;
+      //! Time point the iterates in `_guess_history` belong to; NaN if there are none.
+      typename traits::time_t                      _guess_history_time;
 
       //! @{
       /**
@@ -112,6 +141,12 @@ namespace pfasst
        * @copybrief Sweeper::initialize()
        */
       virtual void initialize() override;
+      /**
+       * @f$ M \vec{u}_0 @f$, or `_M_initial` on the coarse level.
+       *
+       * The product is only computed if the initial state changed since the last call.
+       */
+      virtual shared_ptr<typename traits::encap_t> M_initial_state();
       //! @}
 
       //! @name Problem Equation Evaluation
@@ -129,12 +164,25 @@ namespace pfasst
       /**
        * Evaluation of the implicit part of the problem equation's right hand side: @f$ F_I(\vec{u}, t) @f$.
        *
+       * Convenience wrapper around the in-place version allocating a new Encapsulation for the
+       * result.
+       *
        * @param[in] t  time point to evaluate @f$ F_I(\vec{u},t) @f$ at
        * @param[in] u  spatial data to be passed to @f$ F_I(\vec{u},t) @f$
        * @returns spatial values of function evaluation
        */
       virtual shared_ptr<typename SweeperTrait::encap_t> evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
                                                                            const shared_ptr<typename SweeperTrait::encap_t> u);
+      /**
+       * In-place evaluation of the implicit part of the problem equation's right hand side.
+       *
+       * @param[in]  t       time point to evaluate @f$ F_I(\vec{u},t) @f$ at
+       * @param[in]  u       spatial data to be passed to @f$ F_I(\vec{u},t) @f$
+       * @param[out] result  spatial values of function evaluation; must not be the same as @p u
+       */
+      virtual void evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
+                                     const shared_ptr<typename SweeperTrait::encap_t> u,
+                                     shared_ptr<typename SweeperTrait::encap_t> result);
       /**
        * Implicitly solving the implicit SDC equation.
        *
@@ -157,6 +205,12 @@ namespace pfasst
                                   const typename SweeperTrait::time_t& t,
                                   const typename SweeperTrait::time_t& dt,
                                   const shared_ptr<typename SweeperTrait::encap_t> rhs);
+      /**
+       * Prepares `states()[m]` as initial guess for the implicit solve at node @p m.
+       *
+       * @see IMEX::_initial_guess
+       */
+      virtual void initial_guess(const size_t m);
       //! @}
 
       //! @{
@@ -185,6 +239,13 @@ namespace pfasst
 
       //! @name Configuration and Setup
       //! @{
+      /**
+       * @copybrief Sweeper::set_options()
+       *
+       * Additionally reads the initial guess of the implicit solves (runtime parameter
+       * `initial_guess`).
+       */
+      virtual void set_options() override;
       /**
        * @copybrief Sweeper::setup()
        *
@@ -285,6 +346,9 @@ namespace pfasst
             
       virtual vector<shared_ptr<typename SweeperTrait::encap_t>> integrate_new(const typename SweeperTrait::time_t& dt);
   
+      //! @f$ y = M x @f$, e.g. for the FAS corrections of the transfer
+      void mass_mv(const VectorType& x, VectorType& y) const { M_dune.mv(x, y); }
+
       shared_ptr<MatrixType> get_M_dune(){return make_shared<MatrixType>(M_dune);};
       shared_ptr<MatrixType> get_A_dune() {return make_shared<MatrixType>(A_dune);};
   };
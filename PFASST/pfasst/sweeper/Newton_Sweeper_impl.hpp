@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <limits>
 #include <stdexcept>
 #include <memory>
 #include <vector>
@@ -22,8 +23,13 @@ namespace pfasst
       , _q_integrals(0)
       , _impl_rhs(0)
       , _impl_rhs_restrict(0)
+      , _M_u0(nullptr)
+      , _M_u0_version(0)
       , _num_impl_f_evals(0)
       , _num_impl_solves(0)
+      , _initial_guess(initial_guess_t::PREVIOUS_ITERATE)
+      , _guess_history(0)
+      , _guess_history_time(std::numeric_limits<typename traits::time_t>::quiet_NaN())
   {}
 
   template<class SweeperTrait, typename Enabled>
@@ -42,25 +48,37 @@ namespace pfasst
     assert(this->get_states().size() == num_nodes + 1);
 
     
-    this->last_newton_state().resize(num_nodes + 1);
-    auto& factory = this->get_encap_factory();
-    std::generate(this->last_newton_state().begin(), this->last_newton_state().end(), [&factory](){ return factory.create(); });
+    this->last_newton_state() = this->create_nodes(num_nodes + 1);
     
-    this->_q_integrals.resize(num_nodes + 1);
-    std::generate(this->_q_integrals.begin(), this->_q_integrals.end(),
-             std::bind(&traits::encap_t::factory_t::create, this->encap_factory()));
+    this->_q_integrals = this->create_nodes(num_nodes + 1);
 
-    this->_impl_rhs.resize(num_nodes + 1);
-    std::generate(this->_impl_rhs.begin(), this->_impl_rhs.end(),
-             std::bind(&traits::encap_t::factory_t::create, this->encap_factory()));
+    this->_impl_rhs = this->create_nodes(num_nodes + 1);
     
-    this->_impl_rhs_restrict.resize(num_nodes + 1);
-    std::generate(this->_impl_rhs_restrict.begin(), this->_impl_rhs_restrict.end(),
-             std::bind(&traits::encap_t::factory_t::create, this->encap_factory()));
+    this->_impl_rhs_restrict = this->create_nodes(num_nodes + 1);
+
+    this->_M_u0 = this->get_encap_factory().create();
+    this->_M_u0_version = 0;
     
 
     this->compute_delta_matrices();
   }
+
+  template<class SweeperTrait, typename Enabled>
+  shared_ptr<typename SweeperTrait::encap_t>
+  IMEX<SweeperTrait, Enabled>::M_initial_state()
+  {
+    if (is_coarse) {
+      return this->_M_initial;
+    }
+
+    assert(this->_M_u0 != nullptr);
+    // versions start at 1, hence 0 marks an empty cache
+    if (this->_M_u0_version != this->_state_versions.front()) {
+      M_dune.mv(this->get_initial_state()->get_data(), this->_M_u0->data());
+      this->_M_u0_version = this->_state_versions.front();
+    }
+    return this->_M_u0;
+  }
   
   
   template<class SweeperTrait, typename Enabled>
@@ -81,6 +99,29 @@ namespace pfasst
   
   
 
+  template<class SweeperTrait, typename Enabled>
+  void
+  IMEX<SweeperTrait, Enabled>::set_options()
+  {
+    pfasst::Sweeper<SweeperTrait, Enabled>::set_options();
+
+    const string guess = config::get_value<string>("initial_guess", "previous_iterate");
+    if (guess == "zero") {
+      this->_initial_guess = initial_guess_t::ZERO;
+    } else if (guess == "previous_iterate") {
+      this->_initial_guess = initial_guess_t::PREVIOUS_ITERATE;
+    } else if (guess == "previous_node") {
+      this->_initial_guess = initial_guess_t::PREVIOUS_NODE;
+    } else if (guess == "extrapolate") {
+      this->_initial_guess = initial_guess_t::EXTRAPOLATE;
+    } else {
+      ML_CLOG(ERROR, this->get_logger_id(), "unknown initial guess '" << guess
+                                            << "' (expected zero, previous_iterate, previous_node or extrapolate)");
+      throw std::runtime_error("unknown initial guess for implicit solves: " + guess);
+    }
+    ML_CVLOG(3, this->get_logger_id(), "  initial guess of solves:     " << guess);
+  }
+
   template<class SweeperTrait, typename Enabled>
   void
   IMEX<SweeperTrait, Enabled>::setup()
@@ -119,11 +160,12 @@ namespace pfasst
     const typename traits::time_t dt = this->get_status()->get_dt();
 
     assert(this->get_quadrature() != nullptr);
-    auto nodes = this->get_quadrature()->get_nodes();
-    nodes.insert(nodes.begin(), typename traits::time_t(0.0));
-    const size_t num_nodes = this->get_quadrature()->get_num_nodes();
+    const auto& plan = this->sweep_plan();
+    const auto& times = plan.get_times();
+    const size_t num_nodes = plan.get_num_nodes();
 
-    this->_impl_rhs.front() = this->evaluate_rhs_impl(t, this->get_states().front());
+    this->evaluate_rhs_impl(t, this->get_states().front(), this->_impl_rhs.front());
+    this->rhs_evaluated(0);
 
     ML_CLOG(INFO, this->get_logger_id(),  "Predicting from t=" << t << " over " << num_nodes << " nodes"
                           << " to t=" << (t + dt) << " (dt=" << dt << ")");
@@ -131,8 +173,9 @@ namespace pfasst
 
     for (size_t m = 0; m < num_nodes; ++m) {
       this->states()[m + 1]->data() = this->states()[m]->data();
-      this->_impl_rhs[m + 1] = this->evaluate_rhs_impl(tm, this->get_states()[m + 1]);
-      tm += dt *  (nodes[m+1] - nodes[m]);
+      this->evaluate_rhs_impl(tm, this->get_states()[m + 1], this->_impl_rhs[m + 1]);
+      this->rhs_evaluated(m + 1);
+      tm = times[m + 1];
 
       ML_CVLOG(1, this->get_logger_id(), "");
 
@@ -166,24 +209,21 @@ namespace pfasst
 
 
 	
-    const typename traits::time_t dt = this->get_status()->get_dt();
-    const auto q_mat = this->get_quadrature()->get_q_mat();
-    auto nodes = this->get_quadrature()->get_nodes();
-    nodes.insert(nodes.begin(), typename traits::time_t(0.0));
-    const size_t num_nodes = this->get_quadrature()->get_num_nodes();
+    const auto& plan = this->sweep_plan();
+    const size_t num_nodes = plan.get_num_nodes();
 
     ML_CVLOG(4, this->get_logger_id(), "computing integrals");
     ML_CVLOG(6, this->get_logger_id(), "  q_int     = dt * Q * f_ex");
-    //this->_q_integrals = encap::mat_mul_vec(dt, q_mat, this->_expl_rhs);
+    //this->_q_integrals = encap::mat_mul_vec(1.0, plan.get_q_mat(), this->_expl_rhs);
     ML_CVLOG(6, this->get_logger_id(), "           += dt * Q * f_im");
-    encap::mat_apply(this->_q_integrals, dt, q_mat, this->_impl_rhs, true); //false
+    encap::mat_apply(this->_q_integrals, 1.0, plan.get_q_mat(), this->_impl_rhs, true); //false
 
     ML_CVLOG(4, this->get_logger_id(), "  subtracting function evaluations of previous iteration and adding FAS correction");
 
 
     for (size_t m = 0; m < num_nodes; ++m) {
       for (size_t n = 0; n < m + 1; ++n) {
-        this->_q_integrals[m + 1]->scaled_add(-dt * this->_q_delta_impl(m + 1, n + 1), this->_impl_rhs[n + 1]);
+        this->_q_integrals[m + 1]->scaled_add(-plan.get_q_delta_impl()(m + 1, n + 1), this->_impl_rhs[n + 1]);
       }
 
 //       ML_CVLOG(6, this->get_logger_id(), LOG_FLOAT << "  q_int["<<(m+1)<<"] += tau["<<(m+1)<<"]                  = "
@@ -214,9 +254,9 @@ namespace pfasst
     const typename traits::time_t tend = this->get_status()->get_t_end();
     const int number_time_step = (tend-t)/dt;
     
-    auto nodes = this->get_quadrature()->get_nodes();
-    nodes.insert(nodes.begin(), typename traits::time_t(0.0));
-    const size_t num_nodes = this->get_quadrature()->get_num_nodes();
+    auto& plan = this->sweep_plan();
+    const auto& times = plan.get_times();
+    const size_t num_nodes = plan.get_num_nodes();
 
     ML_CLOG(INFO, this->get_logger_id(), "Sweeping from t=" << t << " over " << num_nodes
                           << " nodes to t=" << (t + dt) << " (dt=" << dt << ")");
@@ -224,39 +264,31 @@ namespace pfasst
     typename traits::time_t tm = t;
     // note: m=0 is initial value and not a quadrature node
     for (size_t m = 0; m < num_nodes; ++m) {
-      ML_CVLOG(4, this->get_logger_id(), "propagating from t["<<m<<"]=" << (t + (dt * nodes[m]))
-                                                   << " to t["<<(m+1)<<"]=" << (t + (dt * nodes[m+1])));
+      ML_CVLOG(4, this->get_logger_id(), "propagating from t["<<m<<"]=" << times[m]
+                                                   << " to t["<<(m+1)<<"]=" << times[m + 1]);
 
 
       // compute right hand side for implicit solve (i.e. the explicit part of the propagation)
-      shared_ptr<typename traits::encap_t> rhs = this->get_encap_factory().create();
-      // rhs = u_0
-     
-      if (is_coarse){
-        rhs->data() =  this->_M_initial->get_data(); //   this->get_states().front()->get_data();
-
-          
-      }else{
-        M_dune.mv(this->get_states().front()->get_data(), rhs->data());
-        
-
-        
-      }
+      shared_ptr<typename traits::encap_t> rhs = plan.scratch()[m + 1];
+      // rhs = M * u_0
+      rhs->data() = this->M_initial_state()->get_data();
 
       // rhs += dt * \sum_{i=0}^m (QI_{m+1,i} fI(u_i^{k+1}) + QE_{m+1,i-1} fE(u_{i-1}^{k+1}) ) + QE_{m+1,m} fE(u_{m}^{k+1})
       for (size_t n = 0; n <= m; ++n) {
-        rhs->scaled_add(dt * this->_q_delta_impl(m + 1, n), this->_impl_rhs[n]);
+        rhs->scaled_add(plan.get_q_delta_impl()(m + 1, n), this->_impl_rhs[n]);
       }
       
       rhs->scaled_add(1.0, this->_q_integrals[m + 1]);
 
       // solve the implicit part
       ML_CVLOG(4, this->get_logger_id(), "  solve(u["<<(m+1)<<"] - dt * QI_{"<<(m+1)<<","<<(m+1)<<"} * f_im["<<(m+1)<<"] = rhs)");
-      this->implicit_solve(this->_impl_rhs[m + 1], this->states()[m + 1], number_time_step, dt * this->_q_delta_impl(m+1, m+1), rhs);
+      this->initial_guess(m + 1);
+      this->implicit_solve(this->_impl_rhs[m + 1], this->states()[m + 1], number_time_step, plan.get_q_delta_impl()(m+1, m+1), rhs);
+      this->rhs_evaluated(m + 1);
 
 
       // reevaluate the explicit part with the new solution value
-      tm += dt * this->_q_delta_impl(m+1, m+1);
+      tm += plan.get_q_delta_impl()(m+1, m+1);
 
 
       ML_CVLOG(4, this->get_logger_id(), "");
@@ -320,20 +352,30 @@ namespace pfasst
     if (initial_only) {
       assert( this->_impl_rhs.front() != nullptr);
 
-      //this->_expl_rhs.front() = this->evaluate_rhs_expl(t0, this->get_initial_state());
-      this->_impl_rhs.front() = this->evaluate_rhs_impl(t0, this->get_initial_state());
+      if (this->is_rhs_stale(0)) {
+        //this->_expl_rhs.front() = this->evaluate_rhs_expl(t0, this->get_initial_state());
+        this->evaluate_rhs_impl(t0, this->get_initial_state(), this->_impl_rhs.front());
+        this->rhs_evaluated(0);
+      } else {
+        this->_num_skipped_evaluations++;
+      }
 
     } else {
-      const typename traits::time_t dt = this->get_status()->get_dt();
-      auto nodes = this->get_quadrature()->get_nodes();
-      nodes.insert(nodes.begin(), 0.0);
+      const auto& times = this->sweep_plan().get_times();
 
       for (size_t m = 0; m < this->get_quadrature()->get_num_nodes() + 1; ++m) {
-        const typename traits::time_t t = t0 + dt * nodes[m];
+        const typename traits::time_t t = times[m];
         assert( this->_impl_rhs[m] != nullptr);
 
+        // states the last transfer left (almost) unchanged keep their evaluation
+        if (!this->is_rhs_stale(m)) {
+          this->_num_skipped_evaluations++;
+          continue;
+        }
+
         //this->_expl_rhs[m] = this->evaluate_rhs_expl(t, this->get_states()[m]);
-        this->_impl_rhs[m] = this->evaluate_rhs_impl(t, this->get_states()[m]);
+        this->evaluate_rhs_impl(t, this->get_states()[m], this->_impl_rhs[m]);
+        this->rhs_evaluated(m);
       }
     }
   }
@@ -349,7 +391,7 @@ namespace pfasst
   vector<shared_ptr<typename SweeperTrait::encap_t>>
   IMEX<SweeperTrait, Enabled>::integrate(const typename SweeperTrait::time_t& dt)
   {
-    auto const q_mat = this->get_quadrature()->get_q_mat();
+    const auto& q_mat = this->get_quadrature()->get_q_mat();
 
     //auto result = encap::mat_mul_vec(dt, q_mat, this->_expl_rhs);
     auto result = encap::mat_mul_vec(dt, q_mat, this->_impl_rhs);
@@ -364,7 +406,7 @@ namespace pfasst
   vector<shared_ptr<typename SweeperTrait::encap_t>>
   IMEX<SweeperTrait, Enabled>::integrate_new(const typename SweeperTrait::time_t& dt)
   {
-    auto const q_mat = this->get_quadrature()->get_q_mat();
+    const auto& q_mat = this->get_quadrature()->get_q_mat();
 
     //vector<shared_ptr<typename SweeperTrait::encap_t>>&
     
@@ -406,8 +448,8 @@ namespace pfasst
     assert(this->get_quadrature() != nullptr);
     assert(this->get_initial_state() != nullptr);
 
-    const typename traits::time_t dt = this->get_status()->get_dt();
     const size_t num_nodes = this->get_quadrature()->get_num_nodes() + 1;
+    const auto& plan = this->sweep_plan();
 
     if (only_last) {
       const size_t cols = this->get_quadrature()->get_q_mat().cols();
@@ -415,28 +457,16 @@ namespace pfasst
       
       
       
-      if (is_coarse){
-        this->residuals().back()->data() =  this->_M_initial->get_data(); //   this->get_states().front()->get_data();
-      }else{
-        M_dune.mv(this->get_initial_state()->get_data(), this->residuals().back()->data());
-      }
-      
-      //M_dune.mv(this->get_initial_state()->get_data(), this->residuals().back()->data());
-      //this->residuals().back()->data() = this->get_initial_state()->get_data();
-      
-      shared_ptr<typename traits::encap_t> uM = this->get_encap_factory().create();	
-      M_dune.mv(this->get_states().back()->get_data(), uM->data());
-      this->residuals().back()->scaled_add(-1.0, uM);	
-      //this->residuals()[m]->scaled_add(-1.0,uM);
-
-      
-      
+      this->residuals().back()->data() = this->M_initial_state()->get_data();
+      M_dune.mmv(this->get_states().back()->get_data(), this->residuals().back()->data());
       this->residuals().back()->scaled_add(1.0, this->get_tau().back());
       for (size_t n = 0; n < cols; ++n) {
-        //this->residuals().back()->scaled_add(dt * this->get_quadrature()->get_q_mat()(rows - 1, n), this->_expl_rhs[n]);
-        this->residuals().back()->scaled_add(dt * this->get_quadrature()->get_q_mat()(rows - 1, n), this->_impl_rhs[n]);
+        //this->residuals().back()->scaled_add(plan.get_q_mat()(rows - 1, n), this->_expl_rhs[n]);
+        this->residuals().back()->scaled_add(plan.get_q_mat()(rows - 1, n), this->_impl_rhs[n]);
       }
     } else {
+      // M * u_0 is the same for all nodes and cached across sweeps
+      const shared_ptr<typename traits::encap_t> uM0 = this->M_initial_state();
       for (size_t m = 0; m < num_nodes; ++m) {
         assert(this->get_states()[m] != nullptr);
         assert(this->residuals()[m] != nullptr);
@@ -451,24 +481,8 @@ namespace pfasst
 	std::cout << "**********************************" << std::endl;	*/
 	
     
-    if (is_coarse){
-        this->residuals()[m]->data() =  this->_M_initial->get_data(); //   this->get_states().front()->get_data();
-    }else{
-        M_dune.mv(this->get_initial_state()->get_data(), this->residuals()[m]->data());
-    }
-    
-	//M_dune.mv(this->get_initial_state()->get_data(), this->residuals()[m]->data());
-
-  //       ML_CVLOG(5, this->get_logger_id(), "        -= u["<<m<<"]   = " << to_string(this->get_states()[m]));
-	
-	shared_ptr<typename traits::encap_t> uM = this->get_encap_factory().create();
-	
-
-	M_dune.mv(this->get_states()[m]->get_data(), uM->data());
-
-	
-	this->residuals()[m]->scaled_add(-1.0,uM);
-        //this->residuals()[m]->scaled_add(-1.0, this->get_states()[m]);
+        this->residuals()[m]->data() = uM0->get_data();
+        M_dune.mmv(this->get_states()[m]->get_data(), this->residuals()[m]->data());
 
         assert(this->get_tau()[m] != nullptr);
   //       ML_CVLOG(5, this->get_logger_id(), "        += tau["<<m<<"] = " << to_string(this->get_tau()[m]));
@@ -476,10 +490,10 @@ namespace pfasst
       }
 
       //ML_CVLOG(5, this->get_logger_id(), "  res += dt * Q * F_ex");
-      //encap::mat_apply(this->residuals(), dt, this->get_quadrature()->get_q_mat(), this->_expl_rhs, false);
+      //encap::mat_apply(this->residuals(), 1.0, plan.get_q_mat(), this->_expl_rhs, false);
 
       ML_CVLOG(5, this->get_logger_id(), "  res += dt * Q * F_im");
-      encap::mat_apply(this->residuals(), dt, this->get_quadrature()->get_q_mat(), this->_impl_rhs, false);
+      encap::mat_apply(this->residuals(), 1.0, plan.get_q_mat(), this->_impl_rhs, false);
 
       ML_CVLOG(5, this->get_logger_id(), "  ==>");
       for (size_t m = 0; m < num_nodes; ++m) {
@@ -525,15 +539,26 @@ namespace pfasst
     throw std::runtime_error("evaluation of explicit part of right-hand-side");
   }*/
 
+  template<class SweeperTrait, typename Enabled>
+  shared_ptr<typename SweeperTrait::encap_t>
+  IMEX<SweeperTrait, Enabled>::evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
+                                                 const shared_ptr<typename SweeperTrait::encap_t> u)
+  {
+    auto result = this->get_encap_factory().create();
+    this->evaluate_rhs_impl(t, u, result);
+    return result;
+  }
+
   /**
    * @throws std::runtime_error if not overwritten in specialized implementation
    */
   template<class SweeperTrait, typename Enabled>
-  shared_ptr<typename SweeperTrait::encap_t>
+  void
   IMEX<SweeperTrait, Enabled>::evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
-                                                 const shared_ptr<typename SweeperTrait::encap_t> u)
+                                                 const shared_ptr<typename SweeperTrait::encap_t> u,
+                                                 shared_ptr<typename SweeperTrait::encap_t> result)
   {
-    UNUSED(t); UNUSED(u);
+    UNUSED(t); UNUSED(u); UNUSED(result);
     throw std::runtime_error("evaluation of implicit part of right-hand-side");
   }
 
@@ -552,6 +577,50 @@ namespace pfasst
     throw std::runtime_error("spatial solver");
   }
 
+  template<class SweeperTrait, typename Enabled>
+  void
+  IMEX<SweeperTrait, Enabled>::initial_guess(const size_t m)
+  {
+    assert(m > 0 && m < this->get_states().size());
+
+    switch (this->_initial_guess) {
+      case initial_guess_t::ZERO:
+        this->states()[m]->zero();
+        break;
+
+      case initial_guess_t::PREVIOUS_ITERATE:
+        // states()[m] still holds the last iterate
+        break;
+
+      case initial_guess_t::PREVIOUS_NODE:
+        this->states()[m]->data() = this->get_states()[m - 1]->get_data();
+        break;
+
+      case initial_guess_t::EXTRAPOLATE: {
+        const auto t = this->get_status()->get_time();
+        if (this->_guess_history.size() != this->get_states().size()) {
+          this->_guess_history = this->create_nodes(this->get_states().size());
+        }
+        if (m == 1 && this->_guess_history_time != t) {
+          // new time step: the history holds iterates of the previous one
+          this->_guess_history_time = std::numeric_limits<typename traits::time_t>::quiet_NaN();
+        }
+
+        auto current = this->get_encap_factory().create_uninitialized();
+        current->data() = this->get_states()[m]->get_data();
+        if (this->_guess_history_time == t) {
+          this->states()[m]->axpby(-1.0, this->_guess_history[m], 2.0);
+        }
+        this->_guess_history[m]->data() = current->get_data();
+
+        if (m == this->get_states().size() - 1) {
+          this->_guess_history_time = t;
+        }
+        break;
+      }
+    }
+  }
+
   template<class SweeperTrait, typename Enabled>
   void
   IMEX<SweeperTrait, Enabled>::compute_delta_matrices()
@@ -663,5 +732,7 @@ namespace pfasst
       ML_CVLOG(5, this->get_logger_id(),
                "  " << this->_q_delta_impl.block(row, 0, 1, this->_q_delta_impl.cols()));
     }
+
+    this->_plan.set_delta_matrices(this->_q_delta_impl, this->_q_delta_expl);
   }
 }  // ::pfasst
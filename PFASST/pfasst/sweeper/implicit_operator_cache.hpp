@@ -0,0 +1,232 @@
+#ifndef _PFASST__SWEEPER__IMPLICIT_OPERATOR_CACHE_HPP_
+#define _PFASST__SWEEPER__IMPLICIT_OPERATOR_CACHE_HPP_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+using std::shared_ptr;
+using std::vector;
+
+#include <dune/istl/operators.hh>
+#include <dune/istl/preconditioners.hh>
+#include <dune/istl/solvers.hh>
+
+#include "pfasst/sweeper/preconditioner.hpp"
+
+#if HAVE_SUITESPARSE_UMFPACK || HAVE_UMFPACK
+  #include <dune/istl/umfpack.hh>
+  #define PFASST_HAVE_UMFPACK 1
+#else
+  #define PFASST_HAVE_UMFPACK 0
+#endif
+
+
+namespace pfasst
+{
+  /**
+   * Cache of the operators @f$ M + c A @f$ of the implicit solves in finite element sweepers.
+   *
+   * With a fixed step width the implicit solve at node @f$ m @f$ always uses the same coefficient
+   * @f$ c = \Delta t \tilde{q}_{mm} @f$ (possibly times a constant diffusivity), i.e. there are only as
+   * many distinct operators as there are quadrature nodes.
+   * Each of them is assembled once together with its preconditioner (see `preconditioner_t`; for
+   * algebraic multigrid this includes the whole hierarchy) or, if UMFPack is available and requested,
+   * its sparse LU factorization.
+   *
+   * Entries are looked up by the exact coefficient and dropped whenever the step width changes.
+   * Lookups and the updates of recycled directions are thread safe; the preconditioner of an entry
+   * (e.g. AMG) may keep state, so solves with the same entry should still not run concurrently.
+   * The cache must be cleared explicitly if @f$ M @f$ or @f$ A @f$ change.
+   *
+   * Iterative solves may recycle a small Krylov subspace per entry across consecutive solves (see
+   * `set_recycle()`), as the systems of a node barely change from one iteration to the next.
+   *
+   * Several systems can be solved at once with `solve_batch()`, which streams @f$ M @f$ and @f$ A @f$
+   * only once per iteration for all of them.
+   *
+   * @tparam MatrixT  `Dune::BCRSMatrix` type of @f$ M @f$ and @f$ A @f$
+   * @tparam VectorT  `Dune::BlockVector` type of solution and right hand side
+   *
+   * @ingroup Sweepers
+   */
+  template<
+    class MatrixT,
+    class VectorT
+  >
+  class ImplicitOperatorCache
+  {
+    public:
+      using matrix_t = MatrixT;
+      using vector_t = VectorT;
+      using field_t = typename MatrixT::field_type;
+
+      //! Assembled operator and everything needed to solve with it.
+      struct entry_t
+      {
+        matrix_t                                                          matrix;
+        shared_ptr<Dune::MatrixAdapter<matrix_t, vector_t, vector_t>>     op;
+        shared_ptr<Dune::Preconditioner<vector_t, vector_t>>              preconditioner;
+#if PFASST_HAVE_UMFPACK
+        shared_ptr<Dune::UMFPack<matrix_t>>                               factorization;
+#endif
+        //! @{
+        //! Recycled directions @f$ w_j @f$, orthonormal w.r.t. the operator, and their images.
+        vector<vector_t>                                                  recycled;
+        vector<vector_t>                                                  op_recycled;
+        //! @}
+        //! Guards `recycled` and `op_recycled`, which every recycling solve with this entry updates.
+        std::mutex                                                        recycle_mutex;
+      };
+
+    protected:
+      std::map<field_t, shared_ptr<entry_t>> _entries;
+      field_t                                _step_width;
+      bool                                   _direct;
+      preconditioner_t                       _preconditioner;
+      size_t                                 _hits;
+      size_t                                 _misses;
+      //! Maximum number of recycled directions per entry; 0 disables recycling.
+      size_t                                 _recycle;
+      //! CG iterations of all solves since the last `reset_iteration_counts()`.
+      size_t                                 _iterations;
+      //! Estimated CG iterations saved by recycling since the last `reset_iteration_counts()`.
+      double                                 _saved_iterations;
+      //! Guards `_entries`; lookups may come from several threads of a node-parallel sweep.
+      shared_ptr<std::mutex>                 _mutex;
+
+      //! Assembles @f$ M + c A @f$ and sets up its solver.
+      virtual shared_ptr<entry_t> build(const matrix_t& M, const matrix_t& A, const field_t& c) const;
+      /**
+       * Adds the correction @p d of the last solve with @p entry to its recycled directions.
+       *
+       * @p d is orthogonalized against the present directions w.r.t. the operator; the oldest
+       * direction is dropped once there are more than `_recycle`. Expects `entry.recycle_mutex` to
+       * be held by the caller.
+       */
+      virtual void recycle(entry_t& entry, vector_t& d) const;
+      /**
+       * Checks whether @f$ M @f$ and @f$ A @f$ have scalar blocks and the same sparsity pattern, which
+       * is what the fused operator of `solve_batch()` relies on, and extracts their diagonals.
+       *
+       * Done on every batch, which costs about one operator application, so reassembled matrices
+       * are always picked up.
+       */
+      virtual bool prepare_batch(const matrix_t& M, const matrix_t& A,
+                                 vector<field_t>& diag_M, vector<field_t>& diag_A) const;
+      /**
+       * @f$ y_k = (M + c_k A) x_k @f$ for all @f$ k @f$ in a single pass over @f$ M @f$ and @f$ A @f$.
+       *
+       * @p x and @p y hold the @f$ K @f$ vectors interleaved, i.e. entry @f$ i @f$ of vector @f$ k @f$
+       * at `i * K + k`.
+       */
+      virtual void apply_batch(const matrix_t& M, const matrix_t& A, const vector<field_t>& c,
+                               const vector<field_t>& x, vector<field_t>& y) const;
+
+    public:
+      ImplicitOperatorCache();
+      ImplicitOperatorCache(const ImplicitOperatorCache<MatrixT, VectorT>& other) = default;
+      ImplicitOperatorCache(ImplicitOperatorCache<MatrixT, VectorT>&& other) = default;
+      virtual ~ImplicitOperatorCache() = default;
+      ImplicitOperatorCache<MatrixT, VectorT>& operator=(const ImplicitOperatorCache<MatrixT, VectorT>& other) = default;
+      ImplicitOperatorCache<MatrixT, VectorT>& operator=(ImplicitOperatorCache<MatrixT, VectorT>&& other) = default;
+
+      /**
+       * Selects sparse direct factorizations instead of preconditioned CG.
+       *
+       * Without UMFPack this is ignored.
+       * Drops all cached entries if the choice changes.
+       */
+      virtual void set_direct(const bool direct);
+      virtual bool is_direct() const;
+
+      /**
+       * Selects the preconditioner of the iterative solves.
+       *
+       * Drops all cached entries if the choice changes.
+       */
+      virtual void set_preconditioner(const preconditioner_t kind);
+      virtual preconditioner_t get_preconditioner() const;
+
+      /**
+       * Number of directions recycled per operator; 0 disables recycling.
+       *
+       * Each iterative solve first projects its initial guess onto the span of the recycled
+       * directions (a Galerkin correction w.r.t. the operator), then runs CG to the residual the
+       * solve would have had to reach from the unprojected guess.
+       * Its correction afterwards becomes a new direction.
+       * Drops all cached entries if the number changes.
+       */
+      virtual void set_recycle(const size_t num);
+      virtual size_t get_recycle() const;
+
+      //! Drops all cached entries if @p dt differs from the step width they were built for.
+      virtual void set_step_width(const field_t& dt);
+      //! Drops all cached entries.
+      virtual void clear();
+
+      //! Cached entry for @f$ M + c A @f$, assembled on first request.
+      virtual shared_ptr<entry_t> get(const matrix_t& M, const matrix_t& A, const field_t& c);
+
+      /**
+       * Solves @f$ (M + c A) x = b @f$ with the cached operator.
+       *
+       * @param[in,out] x          initial guess; solution on return
+       * @param[in,out] b          right hand side; overwritten by the solver
+       * @param[in]     reduction  residual reduction of the iterative solver
+       * @param[in]     max_iter   maximum number of iterations of the iterative solver
+       */
+      virtual void solve(const matrix_t& M, const matrix_t& A, const field_t& c,
+                         vector_t& x, vector_t& b,
+                         const field_t& reduction, const int max_iter);
+      /**
+       * Solves @f$ (M + c_k A) x_k = b_k @f$ for @f$ k = 1, \dots, K @f$ at once.
+       *
+       * The iterative solver runs one CG per system in lockstep, with all @f$ K @f$ vectors stored
+       * interleaved per degree of freedom.
+       * Each iteration then applies all operators in a single traversal of @f$ M @f$ and @f$ A @f$,
+       * which costs about as much as one sparse matrix-vector product since the latter is bound by
+       * memory bandwidth.
+       * The operators @f$ M + c_k A @f$ are never assembled, thus the coefficients may differ.
+       * Each system stops on its own residual reduction; its iterations count towards
+       * `iterations()`.
+       *
+       * Falls back to `solve()` per system unless `can_batch()`, or if @f$ M @f$ and @f$ A @f$ do not
+       * share their sparsity pattern.
+       *
+       * @param[in]     c          coefficient per system
+       * @param[in,out] x          initial guesses; solutions on return
+       * @param[in]     b          right hand sides
+       * @param[in]     reduction  residual reduction of each system
+       * @param[in]     max_iter   maximum number of iterations
+       */
+      virtual void solve_batch(const matrix_t& M, const matrix_t& A, const vector<field_t>& c,
+                               const vector<vector_t*>& x, const vector<const vector_t*>& b,
+                               const field_t& reduction, const int max_iter);
+      /**
+       * Whether `solve_batch()` can solve in lockstep with the current settings.
+       *
+       * That is with iterative solves preconditioned by `preconditioner_t::NONE` or
+       * `preconditioner_t::JACOBI` and without recycling.
+       */
+      virtual bool can_batch() const;
+
+      virtual size_t size() const;
+      virtual size_t hits() const;
+      virtual size_t misses() const;
+      //! CG iterations of `solve()` and `solve_batch()` since the last `reset_iteration_counts()`.
+      virtual size_t iterations() const;
+      /**
+       * Estimate of the CG iterations `solve()` saved by recycling.
+       *
+       * Per solve this is the residual reduction of the projection expressed in iterations at the
+       * convergence rate CG achieved afterwards.
+       */
+      virtual size_t saved_iterations() const;
+      virtual void reset_iteration_counts();
+  };
+}  // ::pfasst
+
+#include "pfasst/sweeper/implicit_operator_cache_impl.hpp"
+
+#endif  // _PFASST__SWEEPER__IMPLICIT_OPERATOR_CACHE_HPP_
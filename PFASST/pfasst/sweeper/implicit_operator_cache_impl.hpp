@@ -0,0 +1,454 @@
+#include "pfasst/sweeper/implicit_operator_cache.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <memory>
+using std::make_shared;
+using std::shared_ptr;
+
+
+namespace pfasst
+{
+  template<class MatrixT, class VectorT>
+  ImplicitOperatorCache<MatrixT, VectorT>::ImplicitOperatorCache()
+    :   _entries()
+      , _step_width(0.0)
+      , _direct(false)
+      , _preconditioner(preconditioner_t::ILU0)
+      , _hits(0)
+      , _misses(0)
+      , _recycle(0)
+      , _iterations(0)
+      , _saved_iterations(0.0)
+      , _mutex(make_shared<std::mutex>())
+  {}
+
+  template<class MatrixT, class VectorT>
+  shared_ptr<typename ImplicitOperatorCache<MatrixT, VectorT>::entry_t>
+  ImplicitOperatorCache<MatrixT, VectorT>::build(const matrix_t& M, const matrix_t& A, const field_t& c) const
+  {
+    auto entry = make_shared<entry_t>();
+    entry->matrix = A;
+    entry->matrix *= c;
+    entry->matrix += M;
+
+#if PFASST_HAVE_UMFPACK
+    if (this->_direct) {
+      entry->factorization = make_shared<Dune::UMFPack<matrix_t>>(entry->matrix, 0);
+      return entry;
+    }
+#endif
+
+    entry->op = make_shared<Dune::MatrixAdapter<matrix_t, vector_t, vector_t>>(entry->matrix);
+    entry->preconditioner = make_preconditioner<matrix_t, vector_t>(this->_preconditioner, entry->matrix, *(entry->op));
+    return entry;
+  }
+
+  template<class MatrixT, class VectorT>
+  void
+  ImplicitOperatorCache<MatrixT, VectorT>::set_direct(const bool direct)
+  {
+    const bool effective = direct && PFASST_HAVE_UMFPACK;
+    if (effective != this->_direct) {
+      this->clear();
+    }
+    this->_direct = effective;
+  }
+
+  template<class MatrixT, class VectorT>
+  bool
+  ImplicitOperatorCache<MatrixT, VectorT>::is_direct() const
+  {
+    return this->_direct;
+  }
+
+  template<class MatrixT, class VectorT>
+  void
+  ImplicitOperatorCache<MatrixT, VectorT>::set_preconditioner(const preconditioner_t kind)
+  {
+    if (kind != this->_preconditioner) {
+      this->clear();
+    }
+    this->_preconditioner = kind;
+  }
+
+  template<class MatrixT, class VectorT>
+  preconditioner_t
+  ImplicitOperatorCache<MatrixT, VectorT>::get_preconditioner() const
+  {
+    return this->_preconditioner;
+  }
+
+  template<class MatrixT, class VectorT>
+  void
+  ImplicitOperatorCache<MatrixT, VectorT>::set_recycle(const size_t num)
+  {
+    if (num != this->_recycle) {
+      this->clear();
+    }
+    this->_recycle = num;
+  }
+
+  template<class MatrixT, class VectorT>
+  size_t
+  ImplicitOperatorCache<MatrixT, VectorT>::get_recycle() const
+  {
+    return this->_recycle;
+  }
+
+  template<class MatrixT, class VectorT>
+  void
+  ImplicitOperatorCache<MatrixT, VectorT>::set_step_width(const field_t& dt)
+  {
+    if (dt != this->_step_width) {
+      this->clear();
+      this->_step_width = dt;
+    }
+  }
+
+  template<class MatrixT, class VectorT>
+  void
+  ImplicitOperatorCache<MatrixT, VectorT>::clear()
+  {
+    std::lock_guard<std::mutex> lock(*(this->_mutex));
+    this->_entries.clear();
+  }
+
+  template<class MatrixT, class VectorT>
+  shared_ptr<typename ImplicitOperatorCache<MatrixT, VectorT>::entry_t>
+  ImplicitOperatorCache<MatrixT, VectorT>::get(const matrix_t& M, const matrix_t& A, const field_t& c)
+  {
+    {
+      std::lock_guard<std::mutex> lock(*(this->_mutex));
+      auto it = this->_entries.find(c);
+      if (it != this->_entries.end()) {
+        this->_hits++;
+        return it->second;
+      }
+      this->_misses++;
+    }
+
+    // assemble outside the lock so that concurrent solves for other coefficients may proceed
+    auto entry = this->build(M, A, c);
+
+    std::lock_guard<std::mutex> lock(*(this->_mutex));
+    return this->_entries.emplace(c, entry).first->second;
+  }
+
+  template<class MatrixT, class VectorT>
+  void
+  ImplicitOperatorCache<MatrixT, VectorT>::solve(const matrix_t& M, const matrix_t& A, const field_t& c,
+                                                 vector_t& x, vector_t& b,
+                                                 const field_t& reduction, const int max_iter)
+  {
+    auto entry = this->get(M, A, c);
+    Dune::InverseOperatorResult statistics;
+
+#if PFASST_HAVE_UMFPACK
+    if (entry->factorization) {
+      entry->factorization->apply(x, b, statistics);
+      return;
+    }
+#endif
+
+    if (this->_recycle == 0) {
+      Dune::CGSolver<vector_t> cg(*(entry->op), *(entry->preconditioner), reduction, max_iter, 0);
+      cg.apply(x, b, statistics);
+
+      std::lock_guard<std::mutex> lock(*(this->_mutex));
+      this->_iterations += statistics.iterations;
+      return;
+    }
+
+    // Galerkin correction of the initial guess within the recycled directions
+    vector_t r = b;
+    entry->matrix.mmv(x, r);
+    const field_t defect = r.two_norm();
+    {
+      std::lock_guard<std::mutex> lock(entry->recycle_mutex);
+      for (size_t j = 0; j < entry->recycled.size(); ++j) {
+        const field_t alpha = entry->recycled[j].dot(r);
+        x.axpy(alpha, entry->recycled[j]);
+        r.axpy(-alpha, entry->op_recycled[j]);
+      }
+    }
+    const field_t projected_defect = r.two_norm();
+
+    vector_t correction = x;
+    correction *= -1.0;
+    double saved = 0.0;
+
+    if (projected_defect > 0.0) {
+      // aim at the residual the solve would have had to reach from the unprojected guess
+      const field_t effective = std::min(field_t(1.0), reduction * defect / projected_defect);
+      Dune::CGSolver<vector_t> cg(*(entry->op), *(entry->preconditioner), effective, max_iter, 0);
+      cg.apply(x, b, statistics);
+
+      if (projected_defect < defect && statistics.conv_rate > 0.0 && statistics.conv_rate < 1.0) {
+        saved = std::log(defect / projected_defect) / -std::log(statistics.conv_rate);
+      }
+    }
+
+    correction += x;
+    {
+      std::lock_guard<std::mutex> lock(entry->recycle_mutex);
+      this->recycle(*entry, correction);
+    }
+
+    std::lock_guard<std::mutex> lock(*(this->_mutex));
+    this->_iterations += statistics.iterations;
+    this->_saved_iterations += saved;
+  }
+
+  template<class MatrixT, class VectorT>
+  void
+  ImplicitOperatorCache<MatrixT, VectorT>::recycle(entry_t& entry, vector_t& d) const
+  {
+    for (size_t j = 0; j < entry.recycled.size(); ++j) {
+      d.axpy(-entry.op_recycled[j].dot(d), entry.recycled[j]);
+    }
+
+    vector_t op_d = d;
+    entry.matrix.mv(d, op_d);
+    const field_t norm2 = d.dot(op_d);
+    if (!(norm2 > 0.0)) {
+      return;
+    }
+
+    d *= 1.0 / std::sqrt(norm2);
+    op_d *= 1.0 / std::sqrt(norm2);
+    entry.recycled.push_back(d);
+    entry.op_recycled.push_back(op_d);
+
+    if (entry.recycled.size() > this->_recycle) {
+      entry.recycled.erase(entry.recycled.begin());
+      entry.op_recycled.erase(entry.op_recycled.begin());
+    }
+  }
+
+  template<class MatrixT, class VectorT>
+  bool
+  ImplicitOperatorCache<MatrixT, VectorT>::prepare_batch(const matrix_t& M, const matrix_t& A,
+                                                         vector<field_t>& diag_M, vector<field_t>& diag_A) const
+  {
+    using block_t = typename matrix_t::block_type;
+    if (block_t::rows != 1 || block_t::cols != 1 || M.N() != A.N() || M.nonzeroes() != A.nonzeroes()) {
+      return false;
+    }
+
+    diag_M.assign(M.N(), field_t(0.0));
+    diag_A.assign(A.N(), field_t(0.0));
+
+    auto row_A = A.begin();
+    for (auto row_M = M.begin(); row_M != M.end(); ++row_M, ++row_A) {
+      auto col_A = row_A->begin();
+      for (auto col_M = row_M->begin(); col_M != row_M->end(); ++col_M, ++col_A) {
+        if (col_A == row_A->end() || col_A.index() != col_M.index()) {
+          return false;
+        }
+        if (col_M.index() == row_M.index()) {
+          diag_M[row_M.index()] = (*col_M)[0][0];
+          diag_A[row_M.index()] = (*col_A)[0][0];
+        }
+      }
+      if (col_A != row_A->end()) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  template<class MatrixT, class VectorT>
+  void
+  ImplicitOperatorCache<MatrixT, VectorT>::apply_batch(const matrix_t& M, const matrix_t& A,
+                                                       const vector<field_t>& c,
+                                                       const vector<field_t>& x, vector<field_t>& y) const
+  {
+    const size_t num = c.size();
+
+    auto row_A = A.begin();
+    for (auto row_M = M.begin(); row_M != M.end(); ++row_M, ++row_A) {
+      field_t* y_i = y.data() + row_M.index() * num;
+      std::fill(y_i, y_i + num, field_t(0.0));
+
+      auto col_A = row_A->begin();
+      for (auto col_M = row_M->begin(); col_M != row_M->end(); ++col_M, ++col_A) {
+        const field_t m_ij = (*col_M)[0][0];
+        const field_t a_ij = (*col_A)[0][0];
+        const field_t* x_j = x.data() + col_M.index() * num;
+        for (size_t k = 0; k < num; ++k) {
+          y_i[k] += (m_ij + c[k] * a_ij) * x_j[k];
+        }
+      }
+    }
+  }
+
+  template<class MatrixT, class VectorT>
+  void
+  ImplicitOperatorCache<MatrixT, VectorT>::solve_batch(const matrix_t& M, const matrix_t& A,
+                                                       const vector<field_t>& c,
+                                                       const vector<vector_t*>& x,
+                                                       const vector<const vector_t*>& b,
+                                                       const field_t& reduction, const int max_iter)
+  {
+    assert(x.size() == c.size() && b.size() == c.size());
+
+    vector<field_t> diag_M, diag_A;
+    if (!this->can_batch() || !this->prepare_batch(M, A, diag_M, diag_A)) {
+      for (size_t k = 0; k < c.size(); ++k) {
+        vector_t rhs = *(b[k]);
+        this->solve(M, A, c[k], *(x[k]), rhs, reduction, max_iter);
+      }
+      return;
+    }
+
+    const size_t num = c.size();
+    const size_t ndofs = M.N();
+    const bool jacobi = this->_preconditioner == preconditioner_t::JACOBI;
+
+    vector<field_t> xs(ndofs * num), r(ndofs * num), z(ndofs * num), p(ndofs * num), q(ndofs * num);
+    for (size_t i = 0; i < ndofs; ++i) {
+      for (size_t k = 0; k < num; ++k) {
+        xs[i * num + k] = (*(x[k]))[i][0];
+      }
+    }
+
+    // r = b - (M + c A) x
+    this->apply_batch(M, A, c, xs, q);
+    for (size_t i = 0; i < ndofs; ++i) {
+      for (size_t k = 0; k < num; ++k) {
+        r[i * num + k] = (*(b[k]))[i][0] - q[i * num + k];
+      }
+    }
+
+    // per system z = D^{-1} r, returning the dot products r.z and r.r
+    auto precondition = [&](vector<field_t>& rho, vector<field_t>& norm2) {
+      std::fill(rho.begin(), rho.end(), field_t(0.0));
+      std::fill(norm2.begin(), norm2.end(), field_t(0.0));
+      for (size_t i = 0; i < ndofs; ++i) {
+        for (size_t k = 0; k < num; ++k) {
+          const field_t r_ik = r[i * num + k];
+          const field_t d = diag_M[i] + c[k] * diag_A[i];
+          const field_t z_ik = (jacobi && d != field_t(0.0)) ? r_ik / d : r_ik;
+          z[i * num + k] = z_ik;
+          rho[k] += r_ik * z_ik;
+          norm2[k] += r_ik * r_ik;
+        }
+      }
+    };
+
+    vector<field_t> rho(num), rho_old(num), norm2(num), alpha(num), beta(num), target(num);
+    vector<bool> active(num);
+    precondition(rho, norm2);
+    p = z;
+    size_t num_active = 0;
+    for (size_t k = 0; k < num; ++k) {
+      target[k] = reduction * std::sqrt(norm2[k]);
+      active[k] = norm2[k] > field_t(0.0);
+      num_active += active[k];
+    }
+
+    size_t iterations = 0;
+    for (int iter = 0; iter < max_iter && num_active > 0; ++iter) {
+      this->apply_batch(M, A, c, p, q);
+      iterations += num_active;
+
+      std::fill(alpha.begin(), alpha.end(), field_t(0.0));
+      for (size_t i = 0; i < ndofs; ++i) {
+        for (size_t k = 0; k < num; ++k) {
+          alpha[k] += p[i * num + k] * q[i * num + k];
+        }
+      }
+      for (size_t k = 0; k < num; ++k) {
+        alpha[k] = (active[k] && alpha[k] != field_t(0.0)) ? rho[k] / alpha[k] : field_t(0.0);
+      }
+
+      for (size_t i = 0; i < ndofs * num; i += num) {
+        for (size_t k = 0; k < num; ++k) {
+          xs[i + k] += alpha[k] * p[i + k];
+          r[i + k] -= alpha[k] * q[i + k];
+        }
+      }
+
+      rho_old = rho;
+      precondition(rho, norm2);
+
+      for (size_t k = 0; k < num; ++k) {
+        if (active[k] && std::sqrt(norm2[k]) <= target[k]) {
+          active[k] = false;
+          num_active--;
+        }
+        beta[k] = (active[k] && rho_old[k] != field_t(0.0)) ? rho[k] / rho_old[k] : field_t(0.0);
+      }
+
+      for (size_t i = 0; i < ndofs * num; i += num) {
+        for (size_t k = 0; k < num; ++k) {
+          p[i + k] = z[i + k] + beta[k] * p[i + k];
+        }
+      }
+    }
+
+    for (size_t i = 0; i < ndofs; ++i) {
+      for (size_t k = 0; k < num; ++k) {
+        (*(x[k]))[i][0] = xs[i * num + k];
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(*(this->_mutex));
+    this->_iterations += iterations;
+  }
+
+  template<class MatrixT, class VectorT>
+  bool
+  ImplicitOperatorCache<MatrixT, VectorT>::can_batch() const
+  {
+    return !this->_direct && this->_recycle == 0
+           && (this->_preconditioner == preconditioner_t::NONE || this->_preconditioner == preconditioner_t::JACOBI);
+  }
+
+  template<class MatrixT, class VectorT>
+  size_t
+  ImplicitOperatorCache<MatrixT, VectorT>::size() const
+  {
+    return this->_entries.size();
+  }
+
+  template<class MatrixT, class VectorT>
+  size_t
+  ImplicitOperatorCache<MatrixT, VectorT>::hits() const
+  {
+    return this->_hits;
+  }
+
+  template<class MatrixT, class VectorT>
+  size_t
+  ImplicitOperatorCache<MatrixT, VectorT>::misses() const
+  {
+    return this->_misses;
+  }
+
+  template<class MatrixT, class VectorT>
+  size_t
+  ImplicitOperatorCache<MatrixT, VectorT>::iterations() const
+  {
+    return this->_iterations;
+  }
+
+  template<class MatrixT, class VectorT>
+  size_t
+  ImplicitOperatorCache<MatrixT, VectorT>::saved_iterations() const
+  {
+    return size_t(std::round(this->_saved_iterations));
+  }
+
+  template<class MatrixT, class VectorT>
+  void
+  ImplicitOperatorCache<MatrixT, VectorT>::reset_iteration_counts()
+  {
+    std::lock_guard<std::mutex> lock(*(this->_mutex));
+    this->_iterations = 0;
+    this->_saved_iterations = 0.0;
+  }
+}  // ::pfasst
@@ -0,0 +1,90 @@
+#ifndef _PFASST__SWEEPER__INEXACT_NEWTON_HPP_
+#define _PFASST__SWEEPER__INEXACT_NEWTON_HPP_
+
+#include "pfasst/config.hpp"
+
+
+namespace pfasst
+{
+  /**
+   * Tolerances of an inexact Newton iteration inside an implicit solve.
+   *
+   * Solving the nonlinear systems of a sweep much more accurately than the sweep itself is accurate
+   * is wasted work.
+   * With `newton_inexact` enabled the Newton iteration of an implicit solve stops once
+   * @f[
+   *   \|f(u_k)\| \leq \max\left(\tau_{min}, \kappa \|r\|\right)
+   * @f]
+   * where @f$ r @f$ is the current residual of the sweeper (`Status::get_abs_res_norm()`), or the
+   * initial Newton residual if the sweeper has not computed one yet, and @f$ \kappa @f$ is
+   * `newton_res_factor` on the finest and `newton_res_factor_coarse` on coarser levels.
+   *
+   * The linear systems are solved to the Eisenstat-Walker forcing terms (choice 2)
+   * @f[
+   *   \eta_k = \gamma \left(\frac{\|f(u_k)\|}{\|f(u_{k-1})\|}\right)^\alpha
+   * @f]
+   * with the usual safeguards, bounded by `newton_eta_max` and never tighter than needed to reach the
+   * outer tolerance.
+   *
+   * Without `newton_inexact` the outer tolerance and the linear reduction are the fixed values given
+   * on construction.
+   *
+   * @tparam precision  floating point type of the norms
+   *
+   * @ingroup Sweepers
+   */
+  template<typename precision = double>
+  class InexactNewton
+  {
+    protected:
+      bool      _enabled;
+      precision _abs_tol;
+      precision _linear_reduction;
+      precision _eta_max;
+      precision _gamma;
+      precision _alpha;
+      precision _res_factor;
+      precision _res_factor_coarse;
+
+      precision _outer_tol;
+      precision _eta;
+      precision _f_norm_prev;
+
+    public:
+      /**
+       * @param[in] abs_tol           outer tolerance without `newton_inexact`; lower bound otherwise
+       * @param[in] linear_reduction  residual reduction of the linear solves without `newton_inexact`
+       */
+      InexactNewton(const precision& abs_tol, const precision& linear_reduction);
+      InexactNewton(const InexactNewton<precision>& other) = default;
+      InexactNewton(InexactNewton<precision>&& other) = default;
+      virtual ~InexactNewton() = default;
+      InexactNewton<precision>& operator=(const InexactNewton<precision>& other) = default;
+      InexactNewton<precision>& operator=(InexactNewton<precision>&& other) = default;
+
+      //! Reads `newton_inexact`, `newton_tol`, `newton_eta_max`, `newton_ew_gamma`, `newton_ew_alpha`,
+      //! `newton_res_factor` and `newton_res_factor_coarse`.
+      virtual void set_options();
+      virtual bool is_enabled() const;
+
+      /**
+       * Starts the Newton iteration of one implicit solve.
+       *
+       * @param[in] f_norm        norm of the initial Newton residual; may be zero if not available
+       * @param[in] sweep_res     current absolute residual of the sweeper; zero if not yet computed
+       * @param[in] coarse        whether the sweeper works on a coarse level
+       */
+      virtual void start(const precision& f_norm, const precision& sweep_res, const bool coarse);
+
+      //! Stopping tolerance of the current Newton iteration.
+      virtual precision outer_tolerance() const;
+      virtual bool converged(const precision& f_norm) const;
+
+      //! Residual reduction of the next linear solve given the current Newton residual.
+      virtual precision forcing(const precision& f_norm);
+  };
+}  // ::pfasst
+
+#include "pfasst/sweeper/inexact_newton_impl.hpp"
+
+#endif  // _PFASST__SWEEPER__INEXACT_NEWTON_HPP_
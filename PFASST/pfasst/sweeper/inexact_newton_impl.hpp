@@ -0,0 +1,104 @@
+#include "pfasst/sweeper/inexact_newton.hpp"
+
+#include <algorithm>
+#include <cmath>
+using std::max;
+using std::min;
+
+
+namespace pfasst
+{
+  template<typename precision>
+  InexactNewton<precision>::InexactNewton(const precision& abs_tol, const precision& linear_reduction)
+    :   _enabled(false)
+      , _abs_tol(abs_tol)
+      , _linear_reduction(linear_reduction)
+      , _eta_max(0.9)
+      , _gamma(0.9)
+      , _alpha(2.0)
+      , _res_factor(0.1)
+      , _res_factor_coarse(0.5)
+      , _outer_tol(abs_tol)
+      , _eta(0.9)
+      , _f_norm_prev(0.0)
+  {}
+
+  template<typename precision>
+  void
+  InexactNewton<precision>::set_options()
+  {
+    this->_enabled = config::get_value<bool>("newton_inexact", this->_enabled);
+    this->_abs_tol = config::get_value<precision>("newton_tol", this->_abs_tol);
+    this->_eta_max = config::get_value<precision>("newton_eta_max", this->_eta_max);
+    this->_gamma = config::get_value<precision>("newton_ew_gamma", this->_gamma);
+    this->_alpha = config::get_value<precision>("newton_ew_alpha", this->_alpha);
+    this->_res_factor = config::get_value<precision>("newton_res_factor", this->_res_factor);
+    this->_res_factor_coarse = config::get_value<precision>("newton_res_factor_coarse", this->_res_factor_coarse);
+    this->_outer_tol = this->_abs_tol;
+  }
+
+  template<typename precision>
+  bool
+  InexactNewton<precision>::is_enabled() const
+  {
+    return this->_enabled;
+  }
+
+  template<typename precision>
+  void
+  InexactNewton<precision>::start(const precision& f_norm, const precision& sweep_res, const bool coarse)
+  {
+    this->_f_norm_prev = 0.0;
+    this->_eta = this->_eta_max;
+
+    if (!this->_enabled) {
+      this->_outer_tol = this->_abs_tol;
+      return;
+    }
+
+    const precision factor = coarse ? this->_res_factor_coarse : this->_res_factor;
+    const precision reference = (sweep_res > 0.0) ? sweep_res : f_norm;
+    this->_outer_tol = max(this->_abs_tol, factor * reference);
+  }
+
+  template<typename precision>
+  precision
+  InexactNewton<precision>::outer_tolerance() const
+  {
+    return this->_outer_tol;
+  }
+
+  template<typename precision>
+  bool
+  InexactNewton<precision>::converged(const precision& f_norm) const
+  {
+    return f_norm < this->_outer_tol;
+  }
+
+  template<typename precision>
+  precision
+  InexactNewton<precision>::forcing(const precision& f_norm)
+  {
+    if (!this->_enabled) {
+      return this->_linear_reduction;
+    }
+
+    if (this->_f_norm_prev > 0.0) {
+      precision eta = this->_gamma * std::pow(f_norm / this->_f_norm_prev, this->_alpha);
+      // do not let the forcing term drop faster than the previous one suggests
+      const precision eta_safe = this->_gamma * std::pow(this->_eta, this->_alpha);
+      if (eta_safe > 0.1) {
+        eta = max(eta, eta_safe);
+      }
+      this->_eta = min(this->_eta_max, eta);
+    }
+
+    // no need to solve more accurately than required to reach the outer tolerance
+    if (f_norm > 0.0) {
+      this->_eta = min(this->_eta_max, max(this->_eta, 0.5 * this->_outer_tol / f_norm));
+    }
+
+    this->_f_norm_prev = f_norm;
+    return this->_eta;
+  }
+}  // ::pfasst
@@ -0,0 +1,80 @@
+#ifndef _PFASST__SWEEPER__PRECONDITIONER_HPP_
+#define _PFASST__SWEEPER__PRECONDITIONER_HPP_
+
+#include <memory>
+#include <string>
+using std::make_shared;
+using std::shared_ptr;
+using std::string;
+
+#include <dune/istl/operators.hh>
+#include <dune/istl/preconditioners.hh>
+#include <dune/istl/paamg/amg.hh>
+
+
+namespace pfasst
+{
+  /**
+   * Preconditioner of the CG solves in finite element sweepers.
+   *
+   * Set via the runtime parameter `impl_preconditioner` (`none`, `jacobi`, `ilu0`, `ssor` or `amg`).
+   */
+  enum class preconditioner_t {
+    //! plain CG
+    NONE,
+    //! diagonal scaling; the only one besides `NONE` that batched solves support
+    JACOBI,
+    //! incomplete LU factorization without fill-in
+    ILU0,
+    //! one symmetric Gauss-Seidel sweep
+    SSOR,
+    //! algebraic multigrid V-cycle with SSOR smoothing; iteration counts independent of the mesh width
+    AMG
+  };
+
+  /**
+   * Sets up a preconditioner for @p matrix.
+   *
+   * The preconditioner keeps references to @p matrix and @p op, which therefore must outlive it.
+   * For `preconditioner_t::AMG` this builds the whole multigrid hierarchy, i.e. the result should be
+   * reused for as long as @p matrix does not change.
+   */
+  template<class MatrixT, class VectorT>
+  shared_ptr<Dune::Preconditioner<VectorT, VectorT>>
+  make_preconditioner(const preconditioner_t kind, const MatrixT& matrix,
+                      const Dune::MatrixAdapter<MatrixT, VectorT, VectorT>& op)
+  {
+    switch (kind) {
+      case preconditioner_t::NONE:
+        return make_shared<Dune::Richardson<VectorT, VectorT>>(1.0);
+
+      case preconditioner_t::JACOBI:
+        return make_shared<Dune::SeqJacobi<MatrixT, VectorT, VectorT>>(matrix, 1, 1.0);
+
+      case preconditioner_t::SSOR:
+        return make_shared<Dune::SeqSSOR<MatrixT, VectorT, VectorT>>(matrix, 1, 1.0);
+
+      case preconditioner_t::AMG:
+      {
+        using operator_t = Dune::MatrixAdapter<MatrixT, VectorT, VectorT>;
+        using smoother_t = Dune::SeqSSOR<MatrixT, VectorT, VectorT>;
+        using criterion_t = Dune::Amg::CoarsenCriterion<Dune::Amg::SymmetricCriterion<MatrixT, Dune::Amg::FirstDiagonal>>;
+
+        typename Dune::Amg::SmootherTraits<smoother_t>::Arguments smoother_args;
+        smoother_args.iterations = 1;
+        smoother_args.relaxationFactor = 1.0;
+
+        criterion_t criterion;
+        criterion.setDebugLevel(0);
+
+        return make_shared<Dune::Amg::AMG<operator_t, VectorT, smoother_t>>(op, criterion, smoother_args);
+      }
+
+      case preconditioner_t::ILU0:
+      default:
+        return make_shared<Dune::SeqILU0<MatrixT, VectorT, VectorT>>(matrix, 1.0);
+    }
+  }
+}  // ::pfasst
+
+#endif  // _PFASST__SWEEPER__PRECONDITIONER_HPP_
@@ -0,0 +1,106 @@
+#ifndef _PFASST__SWEEPER__SWEEP_PLAN_HPP_
+#define _PFASST__SWEEPER__SWEEP_PLAN_HPP_
+
+#include <memory>
+#include <vector>
+using std::shared_ptr;
+using std::vector;
+
+#include "pfasst/globals.hpp"
+#include "pfasst/quadrature.hpp"
+using pfasst::quadrature::IQuadrature;
+
+
+namespace pfasst
+{
+  /**
+   * Everything a sweep needs from the quadrature, precomputed for one time step width.
+   *
+   * Holds the nodes with a leading @f$ 0 @f$, the matrices @f$ \Delta t Q @f$, @f$ \Delta t S @f$ and
+   * @f$ \Delta t Q_\Delta @f$ as well as the absolute node times.
+   * The scaled matrices are only rebuilt when the quadrature, @f$ \Delta t @f$ or the @f$ Q_\Delta @f$
+   * matrices change; a new time step with the same width only shifts the node times.
+   *
+   * The plan also owns one scratch Encapsulation per node for temporaries of the sweeps, allocated
+   * once in `Sweeper::initialize()`.
+   *
+   * @tparam SweeperTrait  type traits of the owning sweeper
+   *
+   * @ingroup Sweepers
+   */
+  template<class SweeperTrait>
+  class SweepPlan
+  {
+    public:
+      using traits = SweeperTrait;
+      using time_t = typename traits::time_t;
+
+    protected:
+      shared_ptr<IQuadrature<time_t>>              _quadrature;
+      time_t                                       _dt;
+      time_t                                       _t;
+      bool                                         _valid;
+      bool                                         _times_valid;
+
+      //! Nodes of the quadrature with @f$ 0 @f$ prepended.
+      vector<time_t>                               _nodes;
+      //! Absolute times @f$ t + \Delta t \tau_m @f$ of `_nodes`.
+      vector<time_t>                               _times;
+      Matrix<time_t>                               _dt_q_mat;
+      Matrix<time_t>                               _dt_s_mat;
+      //! @{
+      //! Unscaled @f$ Q_\Delta @f$ matrices as set by the sweeper; empty if not used.
+      Matrix<time_t>                               _q_delta_impl;
+      Matrix<time_t>                               _q_delta_expl;
+      //! @}
+      Matrix<time_t>                               _dt_q_delta_impl;
+      Matrix<time_t>                               _dt_q_delta_expl;
+
+      vector<shared_ptr<typename traits::encap_t>> _scratch;
+
+    public:
+      SweepPlan();
+      SweepPlan(const SweepPlan<SweeperTrait>& other) = default;
+      SweepPlan(SweepPlan<SweeperTrait>&& other) = default;
+      virtual ~SweepPlan() = default;
+      SweepPlan<SweeperTrait>& operator=(const SweepPlan<SweeperTrait>& other) = default;
+      SweepPlan<SweeperTrait>& operator=(SweepPlan<SweeperTrait>&& other) = default;
+
+      /**
+       * Brings the plan up to date for the step @f$ [t, t + \Delta t] @f$.
+       *
+       * @returns `true` if the scaled matrices had to be rebuilt
+       */
+      virtual bool update(const shared_ptr<IQuadrature<time_t>>& quadrature,
+                          const time_t& t, const time_t& dt);
+      /**
+       * Sets the unscaled @f$ Q_\Delta @f$ matrices, forcing a rebuild on the next `update()`.
+       *
+       * @param[in] q_delta_impl  @f$ Q_\Delta @f$ of the implicit part
+       * @param[in] q_delta_expl  @f$ Q_\Delta @f$ of the explicit part; may be empty
+       */
+      virtual void set_delta_matrices(const Matrix<time_t>& q_delta_impl,
+                                      const Matrix<time_t>& q_delta_expl = Matrix<time_t>());
+      //! Forces a rebuild on the next `update()`.
+      virtual void invalidate();
+
+      virtual size_t                 get_num_nodes() const;
+      virtual const time_t&          get_dt() const;
+      //! Nodes of the quadrature with @f$ 0 @f$ prepended.
+      virtual const vector<time_t>&  get_nodes() const;
+      //! Absolute times of `get_nodes()` within the current step.
+      virtual const vector<time_t>&  get_times() const;
+      virtual const Matrix<time_t>&  get_q_mat() const;
+      virtual const Matrix<time_t>&  get_s_mat() const;
+      virtual const Matrix<time_t>&  get_q_delta_impl() const;
+      virtual const Matrix<time_t>&  get_q_delta_expl() const;
+
+      //! One preallocated Encapsulation per node including the initial value.
+      virtual       vector<shared_ptr<typename traits::encap_t>>& scratch();
+      virtual const vector<shared_ptr<typename traits::encap_t>>& get_scratch() const;
+  };
+}  // ::pfasst
+
+#include "pfasst/sweeper/sweep_plan_impl.hpp"
+
+#endif  // _PFASST__SWEEPER__SWEEP_PLAN_HPP_
@@ -0,0 +1,152 @@
+#include "pfasst/sweeper/sweep_plan.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+
+namespace pfasst
+{
+  template<class SweeperTrait>
+  SweepPlan<SweeperTrait>::SweepPlan()
+    :   _quadrature(nullptr)
+      , _dt(0.0)
+      , _t(0.0)
+      , _valid(false)
+      , _times_valid(false)
+      , _nodes(0)
+      , _times(0)
+      , _scratch(0)
+  {}
+
+  template<class SweeperTrait>
+  bool
+  SweepPlan<SweeperTrait>::update(const shared_ptr<IQuadrature<time_t>>& quadrature,
+                                  const time_t& t, const time_t& dt)
+  {
+    assert(quadrature != nullptr);
+
+    const bool rebuild = !this->_valid || this->_quadrature != quadrature || this->_dt != dt;
+
+    if (rebuild) {
+      this->_quadrature = quadrature;
+      this->_dt = dt;
+
+      this->_nodes.resize(quadrature->get_num_nodes() + 1);
+      this->_nodes.front() = time_t(0.0);
+      std::copy(quadrature->get_nodes().cbegin(), quadrature->get_nodes().cend(), this->_nodes.begin() + 1);
+
+      this->_dt_q_mat = dt * quadrature->get_q_mat();
+      this->_dt_s_mat = dt * quadrature->get_s_mat();
+      this->_dt_q_delta_impl = dt * this->_q_delta_impl;
+      this->_dt_q_delta_expl = dt * this->_q_delta_expl;
+
+      this->_valid = true;
+      this->_times_valid = false;
+    }
+
+    if (!this->_times_valid || this->_t != t) {
+      this->_t = t;
+      this->_times.resize(this->_nodes.size());
+      for (size_t m = 0; m < this->_nodes.size(); ++m) {
+        this->_times[m] = t + dt * this->_nodes[m];
+      }
+      this->_times_valid = true;
+    }
+
+    return rebuild;
+  }
+
+  template<class SweeperTrait>
+  void
+  SweepPlan<SweeperTrait>::set_delta_matrices(const Matrix<time_t>& q_delta_impl,
+                                              const Matrix<time_t>& q_delta_expl)
+  {
+    this->_q_delta_impl = q_delta_impl;
+    this->_q_delta_expl = q_delta_expl;
+    this->invalidate();
+  }
+
+  template<class SweeperTrait>
+  void
+  SweepPlan<SweeperTrait>::invalidate()
+  {
+    this->_valid = false;
+  }
+
+  template<class SweeperTrait>
+  size_t
+  SweepPlan<SweeperTrait>::get_num_nodes() const
+  {
+    assert(this->_valid);
+    return this->_nodes.size() - 1;
+  }
+
+  template<class SweeperTrait>
+  const typename SweepPlan<SweeperTrait>::time_t&
+  SweepPlan<SweeperTrait>::get_dt() const
+  {
+    return this->_dt;
+  }
+
+  template<class SweeperTrait>
+  const vector<typename SweepPlan<SweeperTrait>::time_t>&
+  SweepPlan<SweeperTrait>::get_nodes() const
+  {
+    assert(this->_valid);
+    return this->_nodes;
+  }
+
+  template<class SweeperTrait>
+  const vector<typename SweepPlan<SweeperTrait>::time_t>&
+  SweepPlan<SweeperTrait>::get_times() const
+  {
+    assert(this->_times_valid);
+    return this->_times;
+  }
+
+  template<class SweeperTrait>
+  const Matrix<typename SweepPlan<SweeperTrait>::time_t>&
+  SweepPlan<SweeperTrait>::get_q_mat() const
+  {
+    assert(this->_valid);
+    return this->_dt_q_mat;
+  }
+
+  template<class SweeperTrait>
+  const Matrix<typename SweepPlan<SweeperTrait>::time_t>&
+  SweepPlan<SweeperTrait>::get_s_mat() const
+  {
+    assert(this->_valid);
+    return this->_dt_s_mat;
+  }
+
+  template<class SweeperTrait>
+  const Matrix<typename SweepPlan<SweeperTrait>::time_t>&
+  SweepPlan<SweeperTrait>::get_q_delta_impl() const
+  {
+    assert(this->_valid);
+    return this->_dt_q_delta_impl;
+  }
+
+  template<class SweeperTrait>
+  const Matrix<typename SweepPlan<SweeperTrait>::time_t>&
+  SweepPlan<SweeperTrait>::get_q_delta_expl() const
+  {
+    assert(this->_valid);
+    return this->_dt_q_delta_expl;
+  }
+
+  template<class SweeperTrait>
+  vector<shared_ptr<typename SweeperTrait::encap_t>>&
+  SweepPlan<SweeperTrait>::scratch()
+  {
+    return this->_scratch;
+  }
+
+  template<class SweeperTrait>
+  const vector<shared_ptr<typename SweeperTrait::encap_t>>&
+  SweepPlan<SweeperTrait>::get_scratch() const
+  {
+    return this->_scratch;
+  }
+}  // ::pfasst
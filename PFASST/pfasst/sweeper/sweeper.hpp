@@ -8,6 +8,8 @@ using std::shared_ptr;
 using std::vector;
 
 #include "pfasst/sweeper/traits.hpp"
+#include "pfasst/node_pool.hpp"
+#include "pfasst/sweeper/sweep_plan.hpp"
 #include "pfasst/controller/status.hpp"
 #include "pfasst/encap/encapsulation.hpp"
 #include "pfasst/quadrature.hpp"
@@ -93,11 +95,30 @@ namespace pfasst
 
       //! Status object.
       shared_ptr<Status<typename traits::time_t>>         _status;
+      //! Threads shared with the Controller for per-node assembly; `nullptr` for serial execution.
+      shared_ptr<NodePool>                                _thread_pool;
+      //! Quadrature data scaled to the current step; see `sweep_plan()`.
+      SweepPlan<SweeperTrait>                             _plan;
       //! Tolerance for the absolute residual.
       typename traits::spatial_t                          _abs_residual_tol;
       //! Tolerance for the relative residual.
       typename traits::spatial_t                          _rel_residual_tol;
 
+      //! @{
+      /**
+       * Per node: version of `states()[m]` and the version the right hand side was last evaluated for.
+       *
+       * Writers of a state outside of the sweeper's own predict and sweep report changes through
+       * `touch_state()`; `reevaluate()` then skips all nodes whose versions still match.
+       */
+      vector<size_t>                                      _state_versions;
+      vector<size_t>                                      _rhs_versions;
+      //! Relative change of a state below which `touch_state(m, change)` keeps its evaluation.
+      typename traits::spatial_t                          _reevaluate_tol;
+      //! Number of right hand side evaluations avoided by `reevaluate()`.
+      size_t                                              _num_skipped_evaluations;
+      //! @}
+
       /**
        * Name of the Sweeper in the logs.
        *
@@ -154,6 +175,18 @@ namespace pfasst
        * Routine to instantiate all the internal variables.
        */
       virtual void initialize();
+      /**
+       * Instantiates spatial data for @p num_nodes nodes, each created by the EncapsulationFactory.
+       *
+       * @param[in] num_nodes number of nodes, usually including the initial value
+       * @returns one freshly zeroed Encapsulation per node
+       *
+       * @note There is no contiguous storage of all nodes of one quantity: the `BlockVector` of a
+       *   DuneEncapsulation always owns its buffer and is handed to DUNE as such, so it cannot be a
+       *   view into a shared slab. Quadrature-weighted sums over the nodes go through
+       *   `encap::mat_apply()` instead, which streams all nodes blockwise in one pass.
+       */
+      virtual vector<shared_ptr<typename SweeperTrait::encap_t>> create_nodes(const size_t num_nodes) const;
       //! @}
 
     public:
@@ -182,6 +215,24 @@ namespace pfasst
       //! Read-only version of `status()`.
       virtual const shared_ptr<Status<typename SweeperTrait::time_t>>  get_status() const;
 
+      /**
+       * Accessor for the thread pool running independent per-node work.
+       *
+       * Usually set by the Controller (runtime parameter `assembly_threads`).
+       */
+      virtual       shared_ptr<NodePool>& thread_pool();
+      //! Read-only version of `thread_pool()`.
+      virtual const shared_ptr<NodePool>  get_thread_pool() const;
+
+      /**
+       * Accessor for the sweep plan of the current time step.
+       *
+       * Updates the plan to the quadrature and the time step of `get_status()` first, which only
+       * rebuilds its matrices if @f$ \Delta t @f$ changed.
+       * Must not be called from within per-node tasks.
+       */
+      virtual       SweepPlan<SweeperTrait>&  sweep_plan();
+
       /**
        * Accessor for the EncapsulationFactory used to initialize new spatial data objects.
        */
@@ -193,6 +244,8 @@ namespace pfasst
        * Accessor for the spatial data at the initial time point.
        *
        * @note This is a shortcut for `get_states().front()` with additional error checking.
+       *   As the initial value is handed out for writing, its right hand side is considered stale
+       *   afterwards.
        */
       virtual       shared_ptr<typename SweeperTrait::encap_t>&         initial_state();
       //! Read-only version of `initial_state()`.
@@ -383,6 +436,27 @@ namespace pfasst
        * @overload
        */
       virtual void reevaluate();
+
+      /**
+       * Marks the state at node @p m as modified, i.e. its right hand side as stale.
+       */
+      virtual void touch_state(const size_t m);
+      /**
+       * Marks the state at node @p m as modified if @p change is significant.
+       *
+       * @param[in] m       index of the node
+       * @param[in] change  norm of the change applied to `states()[m]`; compared against
+       *                    `reevaluate_tol` times the norm of the state
+       */
+      virtual void touch_state(const size_t m, const typename SweeperTrait::spatial_t& change);
+      //! Marks all states as modified.
+      virtual void touch_states();
+      //! Whether the right hand side at node @p m does not belong to the current state anymore.
+      virtual bool is_rhs_stale(const size_t m) const;
+      //! Records that the right hand side at node @p m was just evaluated for the current state.
+      virtual void rhs_evaluated(const size_t m);
+      //! Number of right hand side evaluations `reevaluate()` could skip so far.
+      virtual size_t get_num_skipped_evaluations() const;
       /**
        * Integrates spatial data at all time nodes for given time step width.
        *
@@ -26,8 +26,14 @@ namespace pfasst
       , _tau(0)
       , _residuals(0)
       , _status(nullptr)
+      , _thread_pool(nullptr)
+      , _plan()
       , _abs_residual_tol(0.0)
       , _rel_residual_tol(0.0)
+      , _state_versions(0)
+      , _rhs_versions(0)
+      , _reevaluate_tol(0.0)
+      , _num_skipped_evaluations(0)
       , _logger_id("SWEEPER")
   {}
 
@@ -59,6 +65,31 @@ namespace pfasst
     return this->_status;
   }
 
+  template<class SweeperTrait, typename Enabled>
+  shared_ptr<NodePool>&
+  Sweeper<SweeperTrait, Enabled>::thread_pool()
+  {
+    return this->_thread_pool;
+  }
+
+  template<class SweeperTrait, typename Enabled>
+  const shared_ptr<NodePool>
+  Sweeper<SweeperTrait, Enabled>::get_thread_pool() const
+  {
+    return this->_thread_pool;
+  }
+
+  template<class SweeperTrait, typename Enabled>
+  SweepPlan<SweeperTrait>&
+  Sweeper<SweeperTrait, Enabled>::sweep_plan()
+  {
+    assert(this->get_quadrature() != nullptr);
+    assert(this->get_status() != nullptr);
+
+    this->_plan.update(this->get_quadrature(), this->get_status()->get_time(), this->get_status()->get_dt());
+    return this->_plan;
+  }
+
   template<class SweeperTrait, typename Enabled>
   shared_ptr<typename SweeperTrait::encap_t::factory_t>&
   Sweeper<SweeperTrait, Enabled>::encap_factory()
@@ -84,6 +115,7 @@ namespace pfasst
       ML_CLOG(ERROR, this->get_logger_id(), "Sweeper need to be setup first before querying initial state.");
       throw std::runtime_error("sweeper not setup before querying initial state");
     }
+    this->touch_state(0);
     return this->states().front();
   }
 
@@ -198,6 +230,8 @@ namespace pfasst
     this->_rel_residual_tol = config::get_value<typename traits::spatial_t>("rel_res_tol", this->_rel_residual_tol);
     ML_CVLOG(3, this->get_logger_id(), "  absolute residual tolerance: " << this->_abs_residual_tol);
     ML_CVLOG(3, this->get_logger_id(), "  relative residual tolerance: " << this->_rel_residual_tol);
+    this->_reevaluate_tol = config::get_value<typename traits::spatial_t>("reevaluate_tol", this->_reevaluate_tol);
+    ML_CVLOG(3, this->get_logger_id(), "  reevaluation tolerance:      " << this->_reevaluate_tol);
   }
 
   template<class SweeperTrait, typename Enabled>
@@ -248,12 +282,8 @@ namespace pfasst
     //this->_all_time_states.resize()
     
     
-    this->states().resize(num_nodes + 1);
-    auto& factory = this->get_encap_factory();
-    std::generate(this->states().begin(), this->states().end(), [&factory](){ return factory.create(); });
-
-    this->previous_states().resize(num_nodes + 1);
-    std::generate(this->previous_states().begin(), this->previous_states().end(), [&factory](){ return factory.create(); });
+    this->states() = this->create_nodes(num_nodes + 1);
+    this->previous_states() = this->create_nodes(num_nodes + 1);
 
     //this->_M_initial.resize(num_nodes + 1);
     _M_initial= this->get_encap_factory().create();
@@ -261,11 +291,24 @@ namespace pfasst
     
     this->end_state() = this->get_encap_factory().create();
 
-    this->tau().resize(num_nodes + 1);
-    std::generate(this->tau().begin(), this->tau().end(), [&factory](){ return factory.create(); });
+    this->tau() = this->create_nodes(num_nodes + 1);
+    this->residuals() = this->create_nodes(num_nodes + 1);
+    this->_plan.scratch() = this->create_nodes(num_nodes + 1);
+    this->_plan.invalidate();
+
+    // nothing has been evaluated yet
+    this->_state_versions.assign(num_nodes + 1, 1);
+    this->_rhs_versions.assign(num_nodes + 1, 0);
+  }
 
-    this->residuals().resize(num_nodes + 1);
-    std::generate(this->residuals().begin(), this->residuals().end(), [&factory](){ return factory.create(); });
+  template<class SweeperTrait, typename Enabled>
+  vector<shared_ptr<typename SweeperTrait::encap_t>>
+  Sweeper<SweeperTrait, Enabled>::create_nodes(const size_t num_nodes) const
+  {
+    vector<shared_ptr<typename traits::encap_t>> nodes(num_nodes);
+    const auto& factory = this->get_encap_factory();
+    std::generate(nodes.begin(), nodes.end(), [&factory](){ return factory.create(); });
+    return nodes;
   }
 
   /**
@@ -405,6 +448,7 @@ namespace pfasst
     for(size_t m = 1; m < this->get_states().size(); ++m) {
       assert(this->states()[m] != nullptr);
       this->states()[m]->data() = this->get_initial_state()->get_data();
+      this->touch_state(m);
     }
   }
 
@@ -445,6 +489,56 @@ namespace pfasst
     this->reevaluate(false);
   }
 
+  template<class SweeperTrait, typename Enabled>
+  void
+  Sweeper<SweeperTrait, Enabled>::touch_state(const size_t m)
+  {
+    if (m < this->_state_versions.size()) {
+      this->_state_versions[m]++;
+    }
+  }
+
+  template<class SweeperTrait, typename Enabled>
+  void
+  Sweeper<SweeperTrait, Enabled>::touch_state(const size_t m, const typename SweeperTrait::spatial_t& change)
+  {
+    if (change > this->_reevaluate_tol * this->get_states()[m]->norm0()) {
+      this->touch_state(m);
+    }
+  }
+
+  template<class SweeperTrait, typename Enabled>
+  void
+  Sweeper<SweeperTrait, Enabled>::touch_states()
+  {
+    for (size_t m = 0; m < this->_state_versions.size(); ++m) {
+      this->touch_state(m);
+    }
+  }
+
+  template<class SweeperTrait, typename Enabled>
+  bool
+  Sweeper<SweeperTrait, Enabled>::is_rhs_stale(const size_t m) const
+  {
+    return (m >= this->_state_versions.size() || this->_rhs_versions[m] != this->_state_versions[m]);
+  }
+
+  template<class SweeperTrait, typename Enabled>
+  void
+  Sweeper<SweeperTrait, Enabled>::rhs_evaluated(const size_t m)
+  {
+    if (m < this->_state_versions.size()) {
+      this->_rhs_versions[m] = this->_state_versions[m];
+    }
+  }
+
+  template<class SweeperTrait, typename Enabled>
+  size_t
+  Sweeper<SweeperTrait, Enabled>::get_num_skipped_evaluations() const
+  {
+    return this->_num_skipped_evaluations;
+  }
+
   /**
    * @throws std::runtime_error if not overwritten in specialized implementation
    */
@@ -493,12 +587,12 @@ namespace pfasst
         return false;
       }
     } else {
-      for (size_t m = 0; m < num_residuals - 1; ++m) {
+      parallel_for(this->get_thread_pool(), num_residuals - 1, [this](const size_t m) {
         assert(this->get_residuals()[m] != nullptr);
         const auto norm = this->get_residuals()[m]->norm0();
         this->_abs_res_norms[m] = norm;
         this->_rel_res_norms[m] = this->_abs_res_norms[m] / this->get_states()[m]->norm0();
-      }
+      });
 
       this->status()->abs_res_norm() = *(std::max_element(this->_abs_res_norms.cbegin(), this->_abs_res_norms.cend()));
       this->status()->rel_res_norm() = *(std::max_element(this->_rel_res_norms.cbegin(), this->_rel_res_norms.cend()));
@@ -561,12 +655,12 @@ namespace pfasst
           return false;
         }
       } else {
-        for (size_t m = 0; m < num_residuals - 1; ++m) {
+        parallel_for(this->get_thread_pool(), num_residuals - 1, [this](const size_t m) {
           assert(this->get_residuals()[m] != nullptr);
           const auto norm = this->get_residuals()[m]->norm0();
           this->_abs_res_norms[m] = norm;
           this->_rel_res_norms[m] = this->_abs_res_norms[m] / this->get_states()[m]->norm0();
-        }
+        });
 
         this->status()->abs_res_norm() = *(std::max_element(this->_abs_res_norms.cbegin(), this->_abs_res_norms.cend()));
         this->status()->rel_res_norm() = *(std::max_element(this->_rel_res_norms.cbegin(), this->_rel_res_norms.cend()));
@@ -1,6 +1,7 @@
 #include "pfasst/transfer/polynomial.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <stdexcept>
 #include <memory>
 #include <vector>
@@ -97,6 +98,20 @@ namespace pfasst
     // u^F = u^F - T f_delta
     encap::mat_apply(fine->states(), -1.0, this->tmat, fine_deltas, false);
 
+    // the change of u_n^F is bounded by sum_m |T_nm| |f_delta_m|; nodes below the threshold keep
+    // their function evaluations
+    vector<typename traits::fine_spatial_t> delta_norms(num_coarse_nodes);
+    for (size_t m = 0; m < num_coarse_nodes; ++m) {
+      delta_norms[m] = fine_deltas[m]->norm0();
+    }
+    for (size_t n = 0; n < (size_t)this->tmat.rows(); ++n) {
+      typename traits::fine_spatial_t change = 0.0;
+      for (size_t m = 0; m < num_coarse_nodes; ++m) {
+        change += std::abs(this->tmat(n, m)) * delta_norms[m];
+      }
+      fine->touch_state(n, change);
+    }
+
 //     ML_CVLOG(1, "TRANS", "fine states after interpolation:");
 //     for (auto& n : fine->states()) {
 //       ML_CVLOG(1, "TRANS", "  " << to_string(n));
@@ -122,8 +137,8 @@ namespace pfasst
   {
     ML_CVLOG(1, "TRANS", "restrict initial value only");
     // M * fine->get_initial_state()
-    shared_ptr<typename TransferTraits::fine_encap_t> M_initial_state= fine->get_encap_factory().create();
-    fine->get_M_dune()->mv( fine->get_initial_state()->get_data(), M_initial_state->data());
+    shared_ptr<typename TransferTraits::fine_encap_t> M_initial_state= fine->get_encap_factory().create_uninitialized();
+    fine->mass_mv(fine->get_initial_state()->get_data(), M_initial_state->data());
     this->restrict_u(M_initial_state , coarse->_M_initial);    
     
     this->restrict_data(fine->get_initial_state(), coarse->initial_state());
@@ -157,13 +172,19 @@ namespace pfasst
     // this commented out stuff is probably required for non-equal sets of time nodes
 //     const int factor = ((int)num_fine_nodes - 1) / ((int)num_coarse_nodes - 1);
 
+    // c_m = restrict(u_m^F); nodes the restriction (almost) does not change keep their evaluations
+    auto coarse_restricted = coarse->get_encap_factory().create_uninitialized();
     for (size_t m = 1; m < num_coarse_nodes; ++m) {
 //       if (coarse_nodes[m] != fine_nodes[m * factor]) {
 //         CLOG(ERROR, "TRANS") << "coarse nodes are not nested within fine ones."
 //                              << "coarse: " << coarse_nodes << " fine: " << fine_nodes;
 //         throw NotImplementedYet("non-nested nodes");
 //       }
-      this->restrict_data(fine->get_states()[m], coarse->states()[m]);
+      this->restrict_data(fine->get_states()[m], coarse_restricted);
+      coarse->states()[m]->scaled_add(-1.0, coarse_restricted);
+      const auto change = coarse->get_states()[m]->norm0();
+      coarse->states()[m]->data() = coarse_restricted->get_data();
+      coarse->touch_state(m, change);
     }
 
     coarse->reevaluate();
@@ -230,41 +251,32 @@ namespace pfasst
       //}  
     }*/
     
-    for (size_t m = 0; m < num_coarse_nodes + 1; ++m) {
-      
-      shared_ptr<typename TransferTraits::coarse_encap_t> coarse_u= coarse->get_encap_factory().create();	
-      this->restrict_data(fine->get_states()[m], coarse_u);  
-      
-      coarse->get_M_dune()->mv(coarse_u->get_data(),  coarse_integral[m]->data());
-      coarse_integral[m]->data() *= -1;
-      
-      coarse_integral[m]->scaled_add(1,  coarse->integrate(dt)[m]);
-    }
- 
+    // integral[m] -= M * u[m]; the integrals above are computed only once per level
+    parallel_for(this->get_thread_pool(), num_coarse_nodes + 1, [&](const size_t m) {
+      shared_ptr<typename TransferTraits::coarse_encap_t> coarse_u = coarse_factory.create_uninitialized();
+      this->restrict_data(fine->get_states()[m], coarse_u);
+
+      shared_ptr<typename TransferTraits::coarse_encap_t> coarse_Mu = coarse_factory.create_uninitialized();
+      coarse->mass_mv(coarse_u->get_data(), coarse_Mu->data());
+      coarse_integral[m]->scaled_add(-1.0, coarse_Mu);
+    });
+
     //std::cout << "fine integrate " << num_fine_nodes << std::endl;
- 
+
+    auto& fine_factory = fine->get_encap_factory();
     const auto fine_integral = fine->integrate(dt);
-    
-    for (size_t m = 0; m < num_fine_nodes + 1; ++m) {
-      fine->get_M_dune()->mv(fine->get_states()[m]->get_data(),  fine_integral[m]->data());
-      fine_integral[m]->data() *= -1;
-      
-      
-      fine_integral[m]->scaled_add(1,  fine->integrate(dt)[m]);
-    } 
-    
 
+    parallel_for(this->get_thread_pool(), num_fine_nodes + 1, [&](const size_t m) {
+      shared_ptr<typename TransferTraits::fine_encap_t> fine_Mu = fine_factory.create_uninitialized();
+      fine->mass_mv(fine->get_states()[m]->get_data(), fine_Mu->data());
+      fine_integral[m]->scaled_add(-1.0, fine_Mu);
+    });
 
-    for (size_t m = 0; m < num_coarse_nodes + 1; ++m) {
+    parallel_for(this->get_thread_pool(), num_coarse_nodes + 1, [&](const size_t m) {
       this->restrict_u(fine_integral[m], fas[m]);
       fas[m]->scaled_add(-1.0, coarse_integral[m]);
       coarse->tau()[m]->data() = fas[m]->get_data();
-      /*for(int i=0; i<coarse->tau()[m]->data().size(); i++){
-      std::cout << coarse->tau()[m]->data() << std::endl;
-      }*/
-      //std::cout << "norm tau" << coarse->tau()[m]->norm0() << std::endl;
-      //coarse->tau()[m]->data() *=-1;
-    }
+    });
   }
 
 
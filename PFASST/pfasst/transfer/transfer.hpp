@@ -6,6 +6,7 @@
 using std::shared_ptr;
 
 #include "pfasst/transfer/traits.hpp"
+#include "pfasst/node_pool.hpp"
 
 
 namespace pfasst
@@ -40,6 +41,10 @@ namespace pfasst
                     >::value,
                     "Fine Time Type must be convertible to Coarse Time Type");
 
+    protected:
+      //! Threads shared with the Controller for per-node work; `nullptr` for serial execution.
+      shared_ptr<NodePool> _thread_pool;
+
     public:
       Transfer() = default;
       Transfer(const Transfer<TransferTraits, Enabled>& other) = default;
@@ -67,6 +72,11 @@ namespace pfasst
       virtual void fas(const typename TransferTraits::fine_time_t& dt,
                        const shared_ptr<typename TransferTraits::fine_sweeper_t> fine,
                        shared_ptr<typename TransferTraits::coarse_sweeper_t> coarse);
+
+      //! Accessor for the thread pool; usually set by the Controller.
+      virtual       shared_ptr<NodePool>& thread_pool();
+      //! Read-only version of `thread_pool()`.
+      virtual const shared_ptr<NodePool>  get_thread_pool() const;
   };
 }  // ::pfasst
 
@@ -74,4 +74,18 @@ namespace pfasst
     UNUSED(dt); UNUSED(coarse); UNUSED(fine);
     throw std::runtime_error("FAS correction for generic Sweeper");
   }
+
+  template<class TransferTraits, typename Enabled>
+  shared_ptr<NodePool>&
+  Transfer<TransferTraits, Enabled>::thread_pool()
+  {
+    return this->_thread_pool;
+  }
+
+  template<class TransferTraits, typename Enabled>
+  const shared_ptr<NodePool>
+  Transfer<TransferTraits, Enabled>::get_thread_pool() const
+  {
+    return this->_thread_pool;
+  }
 }  // ::pfasst
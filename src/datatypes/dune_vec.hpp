@@ -3,6 +3,7 @@
 #define _PFASST__ENCAP__DUNE_VEC_HPP_
 
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <vector>
 using std::shared_ptr;
@@ -14,6 +15,12 @@ using std::vector;
 
 using Dune::BlockVector;
 using Dune::FieldVector;
+
+//! number of degrees of freedom processed at once by the fused `mat_apply` kernel
+#ifndef DUNE_ENCAP_MAT_APPLY_BLOCK
+  #define DUNE_ENCAP_MAT_APPLY_BLOCK 512
+#endif
+
 #include "pfasst/globals.hpp"
 #include "pfasst/logging.hpp"
 #include "pfasst/encap/encapsulation.hpp"
@@ -96,6 +103,19 @@ namespace pfasst
         virtual void zero();
         virtual void scaled_add(const typename EncapsulationTrait::time_t& a,
                                const shared_ptr<Encapsulation<EncapsulationTrait>> y);
+        //! \\( this \\mathrel{+}= a y + b z \\) in a single pass
+        virtual void scaled_add(const typename EncapsulationTrait::time_t& a,
+                                const shared_ptr<Encapsulation<EncapsulationTrait>> y,
+                                const typename EncapsulationTrait::time_t& b,
+                                const shared_ptr<Encapsulation<EncapsulationTrait>> z);
+        //! \\( this = a y + b \\cdot this \\) in a single pass
+        virtual void axpby(const typename EncapsulationTrait::time_t& a,
+                           const shared_ptr<Encapsulation<EncapsulationTrait>> y,
+                           const typename EncapsulationTrait::time_t& b);
+        //! scaled_add() returning norm0() of the result, computed in the same pass
+        virtual typename EncapsulationTrait::spatial_t
+        scaled_add_norm0(const typename EncapsulationTrait::time_t& a,
+                         const shared_ptr<Encapsulation<EncapsulationTrait>> y);
 
         virtual typename EncapsulationTrait::spatial_t norm0() const;
 
@@ -132,21 +152,100 @@ namespace pfasst
       : public std::enable_shared_from_this<EncapsulationFactory<EncapsulationTrait>>
     {
       protected:
+        /**
+         * Free list of released Encapsulations.
+         *
+         * Owned by the factory; Encapsulations released after the factory is gone are freed.
+         */
+        struct pool_t
+        {
+          std::mutex                                 mutex;
+          vector<Encapsulation<EncapsulationTrait>*> free;
+          size_t                                     size = 0;
+          size_t                                     hits = 0;
+          size_t                                     misses = 0;
+
+          ~pool_t();
+        };
+
         size_t _size;
+        shared_ptr<pool_t> _pool;
+
+        /**
+         * Takes an Encapsulation of the current size from the pool or allocates a new one.
+         *
+         * Released Encapsulations are returned to the pool unless their size does not match the
+         * size of the factory at that time, in which case they are freed.
+         *
+         * @param[out] recycled  whether it was taken from the pool, i.e. holds stale data; new ones
+         *   are zero
+         */
+        virtual shared_ptr<Encapsulation<EncapsulationTrait>> acquire(bool& recycled) const;
 
       public:
         explicit EncapsulationFactory(const size_t size = 0);
         EncapsulationFactory(const EncapsulationFactory<EncapsulationTrait>& other);
         EncapsulationFactory(EncapsulationFactory<EncapsulationTrait>&& other);
-        virtual ~EncapsulationFactory() = default;
+        virtual ~EncapsulationFactory();
         EncapsulationFactory<EncapsulationTrait>& operator=(const EncapsulationFactory<EncapsulationTrait>& other);
         EncapsulationFactory<EncapsulationTrait>& operator=(EncapsulationFactory<EncapsulationTrait>&& other);
 
+        //! Zero-initialized Encapsulation, recycled from the pool where possible.
         virtual shared_ptr<Encapsulation<EncapsulationTrait>> create() const;
+        /**
+         * Encapsulation with unspecified content, recycled from the pool where possible.
+         *
+         * Meant for temporaries which are overwritten entirely right away, e.g. as target of
+         * `BCRSMatrix::mv()` or of a plain assignment.
+         */
+        virtual shared_ptr<Encapsulation<EncapsulationTrait>> create_uninitialized() const;
+
+        //! Number of requests served from the pool.
+        virtual size_t pool_hits() const;
+        //! Number of requests requiring a fresh allocation.
+        virtual size_t pool_misses() const;
+        //! Drops all currently unused Encapsulations held by the pool.
+        virtual void release_pool();
 
         virtual void set_size(const size_t& size);
         virtual size_t size() const;
     };
+
+
+    /**
+     * \( x \mathrel{+}= \sum_{k < K} c_k y_k \) over @p n entries, the row update of `mat_apply_kernel()`.
+     *
+     * Up to 6 terms, i.e. up to 5 nodes plus the initial value, the sum is unrolled at compile time
+     * by `simd::axpy_fixed()`, so each entry of @p x is loaded and stored once.
+     * Either way the terms are added in the order of @p c, thus results do not depend on @p K.
+     *
+     * @param[in] num_terms  number @f$ K @f$ of terms, all with non-zero weight
+     */
+    template<typename SpatialT>
+    void
+    mat_apply_row(const size_t num_terms, const size_t n, const SpatialT* c, const SpatialT* const* y,
+                  SpatialT* __restrict__ x);
+
+    /**
+     * Fused kernel of mat_apply() for DuneEncapsulation.
+     *
+     * Works directly on the contiguous `double` storage of the `BlockVector`s and processes the
+     * degrees of freedom in blocks of `DUNE_ENCAP_MAT_APPLY_BLOCK` entries.
+     * Within one block all rows of @p mat are applied, thus each entry of @p y is streamed from
+     * memory only once instead of once per row.
+     * Zero entries of @p mat are skipped, the remaining ones of a row are summed by
+     * `mat_apply_row()`.
+     */
+    template<
+      class EncapsulationTrait
+    >
+    void
+    mat_apply_kernel(vector<shared_ptr<Encapsulation<EncapsulationTrait>>>& x,
+                     const typename EncapsulationTrait::time_t& a,
+                     const Matrix<typename EncapsulationTrait::time_t>& mat,
+                     const vector<shared_ptr<Encapsulation<EncapsulationTrait>>>& y,
+                     const bool zero_vec_x,
+                     const dune_encap_tag&);
   }  // ::pfasst::encap
     template<typename T>
     static string join(const BlockVector<T>& vec, const string& sep)
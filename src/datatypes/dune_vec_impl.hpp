@@ -1,6 +1,7 @@
 #include "dune_vec.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <stdexcept>
 #include <memory>
@@ -12,6 +13,8 @@ using std::vector;
 #include "pfasst/logging.hpp"
 #include "pfasst/util.hpp"
 
+#include "dune_vec_simd.hpp"
+
 
 namespace pfasst
 {
@@ -119,7 +122,8 @@ namespace pfasst
                  std::is_same<dune_encap_tag, typename EncapsulationTrait::tag_t>::value
                >::type>::zero()
     {
-      std::fill(this->data().begin(), this->data().end(), typename EncapsulationTrait::spatial_t(0.0));
+      if (this->get_data().size() == 0) { return; }
+      simd::zero(this->get_data().size(), &this->data()[0][0]);
     }
 
     template<class EncapsulationTrait>
@@ -131,14 +135,63 @@ namespace pfasst
                >::type>::scaled_add(const typename EncapsulationTrait::time_t& a,
                                    const shared_ptr<Encapsulation<EncapsulationTrait>> y)
     {
+      assert(this->get_data().size() == y->get_data().size());
+      if (this->get_data().size() == 0) { return; }
+
+      simd::axpy(this->get_data().size(), typename EncapsulationTrait::spatial_t(a),
+                 &y->get_data()[0][0], &this->data()[0][0]);
+    }
+
+    template<class EncapsulationTrait>
+    void
+    Encapsulation<
+      EncapsulationTrait,
+      typename std::enable_if<
+                 std::is_same<dune_encap_tag, typename EncapsulationTrait::tag_t>::value
+               >::type>::scaled_add(const typename EncapsulationTrait::time_t& a,
+                                   const shared_ptr<Encapsulation<EncapsulationTrait>> y,
+                                   const typename EncapsulationTrait::time_t& b,
+                                   const shared_ptr<Encapsulation<EncapsulationTrait>> z)
+    {
+      assert(this->get_data().size() == y->get_data().size());
+      assert(this->get_data().size() == z->get_data().size());
+      if (this->get_data().size() == 0) { return; }
+
+      simd::axpy2(this->get_data().size(), typename EncapsulationTrait::spatial_t(a), &y->get_data()[0][0],
+                  typename EncapsulationTrait::spatial_t(b), &z->get_data()[0][0], &this->data()[0][0]);
+    }
+
+    template<class EncapsulationTrait>
+    void
+    Encapsulation<
+      EncapsulationTrait,
+      typename std::enable_if<
+                 std::is_same<dune_encap_tag, typename EncapsulationTrait::tag_t>::value
+               >::type>::axpby(const typename EncapsulationTrait::time_t& a,
+                              const shared_ptr<Encapsulation<EncapsulationTrait>> y,
+                              const typename EncapsulationTrait::time_t& b)
+    {
+      assert(this->get_data().size() == y->get_data().size());
+      if (this->get_data().size() == 0) { return; }
 
-      assert(this->get_data().size() == y->data().size());
+      simd::axpby(this->get_data().size(), typename EncapsulationTrait::spatial_t(a), &y->get_data()[0][0],
+                  typename EncapsulationTrait::spatial_t(b), &this->data()[0][0]);
+    }
 
-      std::transform(this->get_data().begin(), this->get_data().end(), y->data().begin(),
-                this->data().begin(),
-                [a](const typename EncapsulationTrait::spatial_t& xi,
-                    const typename EncapsulationTrait::spatial_t& yi) { return xi + a * yi; });
+    template<class EncapsulationTrait>
+    typename EncapsulationTrait::spatial_t
+    Encapsulation<
+      EncapsulationTrait,
+      typename std::enable_if<
+                 std::is_same<dune_encap_tag, typename EncapsulationTrait::tag_t>::value
+               >::type>::scaled_add_norm0(const typename EncapsulationTrait::time_t& a,
+                                         const shared_ptr<Encapsulation<EncapsulationTrait>> y)
+    {
+      assert(this->get_data().size() == y->get_data().size());
+      if (this->get_data().size() == 0) { return typename EncapsulationTrait::spatial_t(0.0); }
 
+      return simd::axpy_norm0(this->get_data().size(), typename EncapsulationTrait::spatial_t(a),
+                              &y->get_data()[0][0], &this->data()[0][0]);
     }
 
     template<class EncapsulationTrait>
@@ -149,10 +202,8 @@ namespace pfasst
                  std::is_same<dune_encap_tag, typename EncapsulationTrait::tag_t>::value
                >::type>::norm0() const
     {
-      return std::abs(*(std::max_element(this->get_data().begin(), this->get_data().end(),
-                               [](const typename EncapsulationTrait::spatial_t& a,
-                                  const typename EncapsulationTrait::spatial_t& b)
-                                 { return std::abs(a) < std::abs(b); })));
+      if (this->get_data().size() == 0) { return typename EncapsulationTrait::spatial_t(0.0); }
+      return simd::norm0(this->get_data().size(), &this->get_data()[0][0]);
     }
 
     template<class EncapsulationTrait>
@@ -232,6 +283,18 @@ namespace pfasst
     }
 
 
+    template<class EncapsulationTrait>
+    EncapsulationFactory<
+      EncapsulationTrait,
+      typename std::enable_if<
+                 std::is_same<dune_encap_tag, typename EncapsulationTrait::tag_t>::value
+               >::type>::pool_t::~pool_t()
+    {
+      for (auto* encap : this->free) {
+        delete encap;
+      }
+    }
+
     template<class EncapsulationTrait>
     EncapsulationFactory<
       EncapsulationTrait,
@@ -239,7 +302,64 @@ namespace pfasst
                  std::is_same<dune_encap_tag, typename EncapsulationTrait::tag_t>::value
                >::type>::EncapsulationFactory(const size_t size)
       : _size(size)
-    {}
+      , _pool(std::make_shared<pool_t>())
+    {
+      this->_pool->size = size;
+    }
+
+    template<class EncapsulationTrait>
+    EncapsulationFactory<
+      EncapsulationTrait,
+      typename std::enable_if<
+                 std::is_same<dune_encap_tag, typename EncapsulationTrait::tag_t>::value
+               >::type>::~EncapsulationFactory()
+    {
+      ML_CVLOG(1, "ENCAP", "factory pool for size " << this->size() << ": "
+                           << this->pool_hits() << " hits, " << this->pool_misses() << " misses");
+    }
+
+    template<class EncapsulationTrait>
+    shared_ptr<Encapsulation<EncapsulationTrait>>
+    EncapsulationFactory<
+      EncapsulationTrait,
+      typename std::enable_if<
+                 std::is_same<dune_encap_tag, typename EncapsulationTrait::tag_t>::value
+               >::type>::acquire(bool& recycled) const
+    {
+      Encapsulation<EncapsulationTrait>* encap = nullptr;
+      {
+        std::lock_guard<std::mutex> lock(this->_pool->mutex);
+        if (!this->_pool->free.empty()) {
+          encap = this->_pool->free.back();
+          this->_pool->free.pop_back();
+          this->_pool->hits++;
+        } else {
+          this->_pool->misses++;
+        }
+      }
+
+      recycled = (encap != nullptr);
+      if (!recycled) {
+        encap = new Encapsulation<EncapsulationTrait>(this->size());
+      }
+
+      // hand the Encapsulation back to the pool once the last reference is gone;
+      // the pool is only weakly referenced as pooled Encapsulations still point to the control
+      // block holding this deleter (via enable_shared_from_this)
+      std::weak_ptr<pool_t> weak_pool = this->_pool;
+      return shared_ptr<Encapsulation<EncapsulationTrait>>(encap,
+        [weak_pool](Encapsulation<EncapsulationTrait>* released) {
+          auto pool = weak_pool.lock();
+          if (pool) {
+            std::lock_guard<std::mutex> lock(pool->mutex);
+            if (released->get_data().size() == pool->size) {
+              pool->free.push_back(released);
+              return;
+            }
+          }
+          delete released;
+        });
+    }
 
     template<class EncapsulationTrait>
     shared_ptr<Encapsulation<EncapsulationTrait>>
@@ -249,7 +369,67 @@ namespace pfasst
                  std::is_same<dune_encap_tag, typename EncapsulationTrait::tag_t>::value
                >::type>::create() const
     {
-      return std::make_shared<Encapsulation<EncapsulationTrait>>(this->size());
+      bool recycled = false;
+      auto encap = this->acquire(recycled);
+      // freshly allocated ones are zeroed by their constructor already
+      if (recycled) {
+        encap->zero();
+      }
+      return encap;
+    }
+
+    template<class EncapsulationTrait>
+    shared_ptr<Encapsulation<EncapsulationTrait>>
+    EncapsulationFactory<
+      EncapsulationTrait,
+      typename std::enable_if<
+                 std::is_same<dune_encap_tag, typename EncapsulationTrait::tag_t>::value
+               >::type>::create_uninitialized() const
+    {
+      bool recycled = false;
+      return this->acquire(recycled);
+    }
+
+    template<class EncapsulationTrait>
+    size_t
+    EncapsulationFactory<
+      EncapsulationTrait,
+      typename std::enable_if<
+                 std::is_same<dune_encap_tag, typename EncapsulationTrait::tag_t>::value
+               >::type>::pool_hits() const
+    {
+      std::lock_guard<std::mutex> lock(this->_pool->mutex);
+      return this->_pool->hits;
+    }
+
+    template<class EncapsulationTrait>
+    size_t
+    EncapsulationFactory<
+      EncapsulationTrait,
+      typename std::enable_if<
+                 std::is_same<dune_encap_tag, typename EncapsulationTrait::tag_t>::value
+               >::type>::pool_misses() const
+    {
+      std::lock_guard<std::mutex> lock(this->_pool->mutex);
+      return this->_pool->misses;
+    }
+
+    template<class EncapsulationTrait>
+    void
+    EncapsulationFactory<
+      EncapsulationTrait,
+      typename std::enable_if<
+                 std::is_same<dune_encap_tag, typename EncapsulationTrait::tag_t>::value
+               >::type>::release_pool()
+    {
+      vector<Encapsulation<EncapsulationTrait>*> unused;
+      {
+        std::lock_guard<std::mutex> lock(this->_pool->mutex);
+        std::swap(unused, this->_pool->free);
+      }
+      for (auto* encap : unused) {
+        delete encap;
+      }
     }
 
     template<class EncapsulationTrait>
@@ -260,6 +440,14 @@ namespace pfasst
                  std::is_same<dune_encap_tag, typename EncapsulationTrait::tag_t>::value
                >::type>::set_size(const size_t& size)
     {
+      if (size != this->_size) {
+        {
+          std::lock_guard<std::mutex> lock(this->_pool->mutex);
+          this->_pool->size = size;
+        }
+        // pooled Encapsulations are of the old size
+        this->release_pool();
+      }
       this->_size = size;
     }
 
@@ -273,5 +461,123 @@ namespace pfasst
     {
       return this->_size;
     }
+
+
+    template<typename SpatialT>
+    void
+    mat_apply_row(const size_t num_terms, const size_t n, const SpatialT* c, const SpatialT* const* y,
+                  SpatialT* __restrict__ x)
+    {
+      switch (num_terms) {
+        case 0:
+          return;
+        case 1:
+          simd::axpy_fixed<1>(n, c, y, x);
+          return;
+        case 2:
+          simd::axpy_fixed<2>(n, c, y, x);
+          return;
+        case 3:
+          simd::axpy_fixed<3>(n, c, y, x);
+          return;
+        case 4:
+          simd::axpy_fixed<4>(n, c, y, x);
+          return;
+        case 5:
+          simd::axpy_fixed<5>(n, c, y, x);
+          return;
+        case 6:
+          simd::axpy_fixed<6>(n, c, y, x);
+          return;
+        default:
+          for (size_t k = 0; k < num_terms; ++k) {
+            const SpatialT ck = c[k];
+            const SpatialT* __restrict__ yk = y[k];
+            for (size_t i = 0; i < n; ++i) {
+              x[i] += ck * yk[i];
+            }
+          }
+      }
+    }
+
+    template<class EncapsulationTrait>
+    void
+    mat_apply_kernel(vector<shared_ptr<Encapsulation<EncapsulationTrait>>>& x,
+                     const typename EncapsulationTrait::time_t& a,
+                     const Matrix<typename EncapsulationTrait::time_t>& mat,
+                     const vector<shared_ptr<Encapsulation<EncapsulationTrait>>>& y,
+                     const bool zero_vec_x,
+                     const dune_encap_tag&)
+    {
+      using spatial_t = typename EncapsulationTrait::spatial_t;
+
+      const size_t rows = std::min((size_t)mat.rows(), x.size());
+      const size_t cols = mat.cols();
+      assert(y.size() >= cols);
+
+      if (zero_vec_x) {
+        // rows of x without matching row in mat are not visited below
+        for (size_t n = rows; n < x.size(); ++n) {
+          x[n]->zero();
+        }
+      }
+
+      if (rows == 0) {
+        return;
+      }
+
+      const size_t ndofs = x[0]->get_data().size();
+      if (ndofs == 0) {
+        return;
+      }
+
+      // raw views onto the contiguous storage of all involved vectors
+      vector<spatial_t*> xp(rows);
+      for (size_t n = 0; n < rows; ++n) {
+        assert(x[n]->get_data().size() == ndofs);
+        xp[n] = &(x[n]->data()[0][0]);
+      }
+      vector<const spatial_t*> yp(cols);
+      for (size_t m = 0; m < cols; ++m) {
+        assert(y[m]->get_data().size() == ndofs);
+        yp[m] = &(y[m]->get_data()[0][0]);
+      }
+
+      // pre-scaled coefficients and columns per row; (n,m) pairs with vanishing weight are not
+      // touched at all
+      Matrix<spatial_t> coeffs = (a * mat).template cast<spatial_t>();
+      vector<vector<spatial_t>> row_coeffs(rows);
+      vector<vector<const spatial_t*>> row_cols(rows);
+      size_t max_terms = 0;
+      for (size_t n = 0; n < rows; ++n) {
+        for (size_t m = 0; m < cols; ++m) {
+          if (coeffs(n, m) != spatial_t(0.0)) {
+            row_coeffs[n].push_back(coeffs(n, m));
+            row_cols[n].push_back(yp[m]);
+          }
+        }
+        max_terms = std::max(max_terms, row_cols[n].size());
+      }
+
+      vector<const spatial_t*> block_cols(max_terms);
+      const size_t block = DUNE_ENCAP_MAT_APPLY_BLOCK;
+      for (size_t i0 = 0; i0 < ndofs; i0 += block) {
+        const size_t i1 = std::min(i0 + block, ndofs);
+
+        for (size_t n = 0; n < rows; ++n) {
+          spatial_t* __restrict__ xn = xp[n] + i0;
+
+          if (zero_vec_x) {
+            std::fill(xn, xn + (i1 - i0), spatial_t(0.0));
+          }
+
+          const size_t num_terms = row_cols[n].size();
+          for (size_t k = 0; k < num_terms; ++k) {
+            block_cols[k] = row_cols[n][k] + i0;
+          }
+          mat_apply_row(num_terms, i1 - i0, row_coeffs[n].data(), block_cols.data(), xn);
+        }
+      }
+    }
   }  // ::pfasst::encap
 } // ::pfasst
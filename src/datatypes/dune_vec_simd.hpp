@@ -0,0 +1,407 @@
+#ifndef _PFASST__ENCAP__DUNE_VEC_SIMD_HPP_
+#define _PFASST__ENCAP__DUNE_VEC_SIMD_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+using std::size_t;
+using std::string;
+
+/*
+ * Explicit AVX2/AVX-512 code paths are compiled via function attributes and selected at runtime.
+ * They are only available with GCC or Clang on x86; define `PFASST_NO_SIMD` to always use the
+ * portable loops.
+ */
+#if !defined(PFASST_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) \
+    && (defined(__x86_64__) || defined(__i386__))
+  #define PFASST_SIMD_X86
+  #include <immintrin.h>
+#endif
+
+
+namespace pfasst
+{
+  namespace encap
+  {
+    /**
+     * BLAS-1 like kernels on contiguous storage as used by DuneEncapsulation.
+     *
+     * Each kernel comes as a portable template and, for `double`, as an overload dispatching at
+     * runtime to the widest instruction set supported by the CPU.
+     *
+     * All vectors are of length @p n; the written vector must not overlap any of the read ones.
+     */
+    namespace simd
+    {
+      //! @name Portable Kernels
+      //! @{
+      //! \\( x = 0 \\)
+      template<typename T>
+      inline void zero(const size_t n, T* x)
+      {
+        std::fill(x, x + n, T(0.0));
+      }
+
+      //! \\( x \\mathrel{+}= a y \\)
+      template<typename T>
+      inline void axpy(const size_t n, const T a, const T* __restrict__ y, T* __restrict__ x)
+      {
+        for (size_t i = 0; i < n; ++i) {
+          x[i] += a * y[i];
+        }
+      }
+
+      //! \\( x = a y + b x \\)
+      template<typename T>
+      inline void axpby(const size_t n, const T a, const T* __restrict__ y, const T b,
+                        T* __restrict__ x)
+      {
+        for (size_t i = 0; i < n; ++i) {
+          x[i] = a * y[i] + b * x[i];
+        }
+      }
+
+      //! \\( x \\mathrel{+}= a y + b z \\)
+      template<typename T>
+      inline void axpy2(const size_t n, const T a, const T* __restrict__ y, const T b,
+                        const T* __restrict__ z, T* __restrict__ x)
+      {
+        for (size_t i = 0; i < n; ++i) {
+          x[i] += a * y[i] + b * z[i];
+        }
+      }
+
+      //! \\( \\|x\\|_\\infty \\)
+      template<typename T>
+      inline T norm0(const size_t n, const T* x)
+      {
+        T m = T(0.0);
+        for (size_t i = 0; i < n; ++i) {
+          m = std::max(m, std::abs(x[i]));
+        }
+        return m;
+      }
+
+      //! \\( x \\mathrel{+}= a y \\), returning \\( \\|x\\|_\\infty \\) of the updated @p x
+      template<typename T>
+      inline T axpy_norm0(const size_t n, const T a, const T* __restrict__ y, T* __restrict__ x)
+      {
+        T m = T(0.0);
+        for (size_t i = 0; i < n; ++i) {
+          x[i] += a * y[i];
+          m = std::max(m, std::abs(x[i]));
+        }
+        return m;
+      }
+
+      /**
+       * \\( x \\mathrel{+}= \\sum_{m < M} c_m y_m \\) for a number of vectors @p M known at compile
+       * time.
+       *
+       * The sum over @p m is fully unrolled, so each entry of @p x is loaded and stored only once.
+       * The terms are added in the same order as by @p M subsequent calls of `axpy()`.
+       */
+      template<size_t M, typename T>
+      inline void axpy_fixed(const size_t n, const T* c, const T* const* y, T* __restrict__ x)
+      {
+        for (size_t i = 0; i < n; ++i) {
+          T sum = x[i];
+          for (size_t m = 0; m < M; ++m) {
+            sum += c[m] * y[m][i];
+          }
+          x[i] = sum;
+        }
+      }
+      //! @}
+
+
+      namespace detail
+      {
+        //! Set of `double` kernels for one instruction set.
+        struct kernels_t
+        {
+          const char* name;
+          void   (*axpy)(const size_t, const double, const double*, double*);
+          void   (*axpby)(const size_t, const double, const double*, const double, double*);
+          void   (*axpy2)(const size_t, const double, const double*, const double, const double*, double*);
+          double (*norm0)(const size_t, const double*);
+          double (*axpy_norm0)(const size_t, const double, const double*, double*);
+        };
+
+        inline void   generic_axpy(const size_t n, const double a, const double* y, double* x)
+        { simd::axpy<double>(n, a, y, x); }
+        inline void   generic_axpby(const size_t n, const double a, const double* y, const double b, double* x)
+        { simd::axpby<double>(n, a, y, b, x); }
+        inline void   generic_axpy2(const size_t n, const double a, const double* y, const double b,
+                                    const double* z, double* x)
+        { simd::axpy2<double>(n, a, y, b, z, x); }
+        inline double generic_norm0(const size_t n, const double* x)
+        { return simd::norm0<double>(n, x); }
+        inline double generic_axpy_norm0(const size_t n, const double a, const double* y, double* x)
+        { return simd::axpy_norm0<double>(n, a, y, x); }
+
+#ifdef PFASST_SIMD_X86
+        // AVX2 + FMA: 4 doubles per register
+
+        __attribute__((target("avx2,fma")))
+        inline __m256d avx2_abs(const __m256d v)
+        {
+          return _mm256_andnot_pd(_mm256_set1_pd(-0.0), v);
+        }
+
+        __attribute__((target("avx2,fma")))
+        inline double avx2_hmax(const __m256d v)
+        {
+          const __m128d m = _mm_max_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+          return _mm_cvtsd_f64(_mm_max_sd(m, _mm_unpackhi_pd(m, m)));
+        }
+
+        __attribute__((target("avx2,fma")))
+        inline void avx2_axpy(const size_t n, const double a, const double* y, double* x)
+        {
+          const __m256d va = _mm256_set1_pd(a);
+          size_t i = 0;
+          for (; i + 4 <= n; i += 4) {
+            _mm256_storeu_pd(x + i, _mm256_fmadd_pd(va, _mm256_loadu_pd(y + i), _mm256_loadu_pd(x + i)));
+          }
+          for (; i < n; ++i) {
+            x[i] += a * y[i];
+          }
+        }
+
+        __attribute__((target("avx2,fma")))
+        inline void avx2_axpby(const size_t n, const double a, const double* y, const double b, double* x)
+        {
+          const __m256d va = _mm256_set1_pd(a);
+          const __m256d vb = _mm256_set1_pd(b);
+          size_t i = 0;
+          for (; i + 4 <= n; i += 4) {
+            const __m256d bx = _mm256_mul_pd(vb, _mm256_loadu_pd(x + i));
+            _mm256_storeu_pd(x + i, _mm256_fmadd_pd(va, _mm256_loadu_pd(y + i), bx));
+          }
+          for (; i < n; ++i) {
+            x[i] = a * y[i] + b * x[i];
+          }
+        }
+
+        __attribute__((target("avx2,fma")))
+        inline void avx2_axpy2(const size_t n, const double a, const double* y, const double b,
+                               const double* z, double* x)
+        {
+          const __m256d va = _mm256_set1_pd(a);
+          const __m256d vb = _mm256_set1_pd(b);
+          size_t i = 0;
+          for (; i + 4 <= n; i += 4) {
+            const __m256d t = _mm256_fmadd_pd(va, _mm256_loadu_pd(y + i), _mm256_loadu_pd(x + i));
+            _mm256_storeu_pd(x + i, _mm256_fmadd_pd(vb, _mm256_loadu_pd(z + i), t));
+          }
+          for (; i < n; ++i) {
+            x[i] += a * y[i] + b * z[i];
+          }
+        }
+
+        __attribute__((target("avx2,fma")))
+        inline double avx2_norm0(const size_t n, const double* x)
+        {
+          __m256d vm = _mm256_setzero_pd();
+          size_t i = 0;
+          for (; i + 4 <= n; i += 4) {
+            vm = _mm256_max_pd(vm, avx2_abs(_mm256_loadu_pd(x + i)));
+          }
+          double m = avx2_hmax(vm);
+          for (; i < n; ++i) {
+            m = std::max(m, std::abs(x[i]));
+          }
+          return m;
+        }
+
+        __attribute__((target("avx2,fma")))
+        inline double avx2_axpy_norm0(const size_t n, const double a, const double* y, double* x)
+        {
+          const __m256d va = _mm256_set1_pd(a);
+          __m256d vm = _mm256_setzero_pd();
+          size_t i = 0;
+          for (; i + 4 <= n; i += 4) {
+            const __m256d vx = _mm256_fmadd_pd(va, _mm256_loadu_pd(y + i), _mm256_loadu_pd(x + i));
+            _mm256_storeu_pd(x + i, vx);
+            vm = _mm256_max_pd(vm, avx2_abs(vx));
+          }
+          double m = avx2_hmax(vm);
+          for (; i < n; ++i) {
+            x[i] += a * y[i];
+            m = std::max(m, std::abs(x[i]));
+          }
+          return m;
+        }
+
+        // AVX-512F: 8 doubles per register, tails handled with masked loads/stores
+
+        // GCC's own _mm512_undefined_pd() triggers bogus uninitialized warnings
+#if defined(__GNUC__) && !defined(__clang__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wuninitialized"
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+        __attribute__((target("avx512f")))
+        inline __mmask8 avx512_tail(const size_t r)
+        {
+          return (__mmask8)((1u << r) - 1u);
+        }
+
+        __attribute__((target("avx512f")))
+        inline void avx512_axpy(const size_t n, const double a, const double* y, double* x)
+        {
+          const __m512d va = _mm512_set1_pd(a);
+          size_t i = 0;
+          for (; i + 8 <= n; i += 8) {
+            _mm512_storeu_pd(x + i, _mm512_fmadd_pd(va, _mm512_loadu_pd(y + i), _mm512_loadu_pd(x + i)));
+          }
+          if (i < n) {
+            const __mmask8 k = avx512_tail(n - i);
+            const __m512d vx = _mm512_maskz_loadu_pd(k, x + i);
+            _mm512_mask_storeu_pd(x + i, k, _mm512_fmadd_pd(va, _mm512_maskz_loadu_pd(k, y + i), vx));
+          }
+        }
+
+        __attribute__((target("avx512f")))
+        inline void avx512_axpby(const size_t n, const double a, const double* y, const double b, double* x)
+        {
+          const __m512d va = _mm512_set1_pd(a);
+          const __m512d vb = _mm512_set1_pd(b);
+          size_t i = 0;
+          for (; i + 8 <= n; i += 8) {
+            const __m512d bx = _mm512_mul_pd(vb, _mm512_loadu_pd(x + i));
+            _mm512_storeu_pd(x + i, _mm512_fmadd_pd(va, _mm512_loadu_pd(y + i), bx));
+          }
+          if (i < n) {
+            const __mmask8 k = avx512_tail(n - i);
+            const __m512d bx = _mm512_mul_pd(vb, _mm512_maskz_loadu_pd(k, x + i));
+            _mm512_mask_storeu_pd(x + i, k, _mm512_fmadd_pd(va, _mm512_maskz_loadu_pd(k, y + i), bx));
+          }
+        }
+
+        __attribute__((target("avx512f")))
+        inline void avx512_axpy2(const size_t n, const double a, const double* y, const double b,
+                                 const double* z, double* x)
+        {
+          const __m512d va = _mm512_set1_pd(a);
+          const __m512d vb = _mm512_set1_pd(b);
+          size_t i = 0;
+          for (; i + 8 <= n; i += 8) {
+            const __m512d t = _mm512_fmadd_pd(va, _mm512_loadu_pd(y + i), _mm512_loadu_pd(x + i));
+            _mm512_storeu_pd(x + i, _mm512_fmadd_pd(vb, _mm512_loadu_pd(z + i), t));
+          }
+          if (i < n) {
+            const __mmask8 k = avx512_tail(n - i);
+            const __m512d t = _mm512_fmadd_pd(va, _mm512_maskz_loadu_pd(k, y + i), _mm512_maskz_loadu_pd(k, x + i));
+            _mm512_mask_storeu_pd(x + i, k, _mm512_fmadd_pd(vb, _mm512_maskz_loadu_pd(k, z + i), t));
+          }
+        }
+
+        __attribute__((target("avx512f")))
+        inline double avx512_norm0(const size_t n, const double* x)
+        {
+          __m512d vm = _mm512_setzero_pd();
+          size_t i = 0;
+          for (; i + 8 <= n; i += 8) {
+            vm = _mm512_max_pd(vm, _mm512_abs_pd(_mm512_loadu_pd(x + i)));
+          }
+          if (i < n) {
+            // masked-off lanes load as zero, which never exceeds the maximum of absolute values
+            vm = _mm512_max_pd(vm, _mm512_abs_pd(_mm512_maskz_loadu_pd(avx512_tail(n - i), x + i)));
+          }
+          return _mm512_reduce_max_pd(vm);
+        }
+
+        __attribute__((target("avx512f")))
+        inline double avx512_axpy_norm0(const size_t n, const double a, const double* y, double* x)
+        {
+          const __m512d va = _mm512_set1_pd(a);
+          __m512d vm = _mm512_setzero_pd();
+          size_t i = 0;
+          for (; i + 8 <= n; i += 8) {
+            const __m512d vx = _mm512_fmadd_pd(va, _mm512_loadu_pd(y + i), _mm512_loadu_pd(x + i));
+            _mm512_storeu_pd(x + i, vx);
+            vm = _mm512_max_pd(vm, _mm512_abs_pd(vx));
+          }
+          if (i < n) {
+            const __mmask8 k = avx512_tail(n - i);
+            const __m512d vx = _mm512_fmadd_pd(va, _mm512_maskz_loadu_pd(k, y + i), _mm512_maskz_loadu_pd(k, x + i));
+            _mm512_mask_storeu_pd(x + i, k, vx);
+            vm = _mm512_max_pd(vm, _mm512_abs_pd(vx));
+          }
+          return _mm512_reduce_max_pd(vm);
+        }
+#if defined(__GNUC__) && !defined(__clang__)
+  #pragma GCC diagnostic pop
+#endif
+#endif  // PFASST_SIMD_X86
+
+        inline kernels_t select_kernels()
+        {
+#ifdef PFASST_SIMD_X86
+          __builtin_cpu_init();
+          if (__builtin_cpu_supports("avx512f")) {
+            return kernels_t{"avx512", avx512_axpy, avx512_axpby, avx512_axpy2, avx512_norm0, avx512_axpy_norm0};
+          }
+          if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return kernels_t{"avx2", avx2_axpy, avx2_axpby, avx2_axpy2, avx2_norm0, avx2_axpy_norm0};
+          }
+#endif
+          return kernels_t{"generic", generic_axpy, generic_axpby, generic_axpy2, generic_norm0, generic_axpy_norm0};
+        }
+
+        //! Kernels for the running CPU; selected on first use.
+        inline const kernels_t& kernels()
+        {
+          static const kernels_t selected = select_kernels();
+          return selected;
+        }
+      }  // ::pfasst::encap::simd::detail
+
+      //! Name of the instruction set the `double` kernels dispatch to.
+      inline string isa_name()
+      {
+        return string(detail::kernels().name);
+      }
+
+      //! @name Dispatched Kernels for `double`
+      //! @{
+      inline void zero(const size_t n, double* x)
+      {
+        std::fill(x, x + n, 0.0);
+      }
+
+      inline void axpy(const size_t n, const double a, const double* y, double* x)
+      {
+        detail::kernels().axpy(n, a, y, x);
+      }
+
+      inline void axpby(const size_t n, const double a, const double* y, const double b, double* x)
+      {
+        detail::kernels().axpby(n, a, y, b, x);
+      }
+
+      inline void axpy2(const size_t n, const double a, const double* y, const double b,
+                        const double* z, double* x)
+      {
+        detail::kernels().axpy2(n, a, y, b, z, x);
+      }
+
+      inline double norm0(const size_t n, const double* x)
+      {
+        return detail::kernels().norm0(n, x);
+      }
+
+      inline double axpy_norm0(const size_t n, const double a, const double* y, double* x)
+      {
+        return detail::kernels().axpy_norm0(n, a, y, x);
+      }
+      //! @}
+    }  // ::pfasst::encap::simd
+  }  // ::pfasst::encap
+}  // ::pfasst
+
+#endif  // _PFASST__ENCAP__DUNE_VEC_SIMD_HPP_
@@ -5,6 +5,7 @@
 # include "config.h"
 #endif
 #include <iostream>
+#include <string>
 #include <dune/common/parallel/mpihelper.hh> // An initializer of MPI
 #include <dune/common/exceptions.hh> // We use exceptions
 #include <dune/grid/utility/structuredgridfactory.hh>
@@ -57,6 +58,7 @@ int main(int argc, char** argv)
   auto basis = Basis{gridptr->leafGridView()};
   // assemble matrces
   const auto dt = 0.05;
+  const int num_steps = (argc>1) ? std::stoi(argv[1]) : 1;
   using MatrixType = Dune::BCRSMatrix<Dune::FieldMatrix<double, 1, 1> >;
   MatrixType mass;
   MatrixType stiffness;
@@ -141,11 +143,14 @@ int main(int argc, char** argv)
 
   //// TNNMG without actual constraints
   //using Functional = Dune::TNNMG::EnergyFunctional<MatrixType, VectorType, double,1>;
-  using Functional = Dune::TNNMG::EnergyFunctional<MatrixType, VectorType, decltype(phiprime), decltype(phiprime), decltype(phi2prime), double>;
+  // the functional only refers to matrix_ and rhs, so every time step below reuses the whole TNNMG setup
+  using Functional = Dune::TNNMG::EnergyFunctional<MatrixType&, VectorType&, decltype(phiprime), decltype(phiprime), decltype(phi2prime), double>;
 
   //auto J = Functional(df, newton_rhs, lower, upper);
   //auto J = Functional(this->M_dune, this->A_dune, dt, _nu, w, rhs);
-  auto J = Functional(matrix_, rhs, w, phiprime, phiprime, phi2prime);
+  VectorType offset(rhs.size());
+  offset=0;
+  auto J = Functional(matrix_, rhs, w, phiprime, phiprime, phi2prime, offset);
   //using LocalFunctional = Dune::TNNMG::EnergyFunctional<MatrixType::block_type, VectorType::block_type, decltype(phiprime), decltype(phiprime), decltype(phi2prime), double>;
   //using LocalFunctional = Dune::TNNMG::EnergyDirectionalRestriction<MatrixType::block_type, VectorType::block_type, decltype(phiprime),double>;
 
@@ -231,8 +236,14 @@ int main(int argc, char** argv)
   //auto tolerance = 1e-8;
   //solver.addCriterion(Dune::Solvers::correctionNormCriterion(step, norm, tolerance, correctionNorms));
 
-  solver.preprocess();
-  solver.solve();
+  // implicit Euler steps; after the first one only the right hand side changes and u is the initial guess
+  for (int n = 0; n < num_steps; ++n)
+  {
+    if (n > 0)
+      mass.mv(u, rhs);
+    solver.preprocess();
+    solver.solve();
+  }
 
 
   // TNNMG solve
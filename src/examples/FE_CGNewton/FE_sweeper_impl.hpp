@@ -134,10 +134,10 @@ namespace pfasst
             (*w)[j]=0;
         }
 
-        for(int i=0; i<this->M_dune.M(); i++){
-            for(int j=0; j<this->M_dune.M(); j++){
-                if(this->M_dune.exists(i,j))
-                (*w)[i][0]= ((double) (*w)[i][0]) + ((double) this->M_dune[i][j][0][0]);
+        // lumped mass: row sums over the stored entries of M only
+        for (auto row = this->M_dune.begin(); row != this->M_dune.end(); ++row) {
+            for (auto col = row->begin(); col != row->end(); ++col) {
+                (*w)[row.index()][0] += (*col)[0][0];
             }
         }
 
@@ -158,6 +158,7 @@ namespace pfasst
         IMEX<SweeperTrait, Enabled>::set_options();
 
         this->_nu = config::get_value<spatial_t>("nu", this->_nu);
+        this->_newton.set_options();
 
         int num_nodes = this->get_quadrature()->get_num_nodes();
 
@@ -295,10 +296,12 @@ namespace pfasst
         //ML_CLOG(INFO, this->get_logger_id(), "  expl:        " << this->_num_expl_f_evals);
         ML_CLOG(INFO, this->get_logger_id(), "  impl:        " << this->_num_impl_f_evals);
         ML_CLOG(INFO, this->get_logger_id(), "  impl solves: " << this->_num_impl_solves);
+        ML_CLOG(INFO, this->get_logger_id(), "  skipped:     " << this->_num_skipped_evaluations);
 
         //this->_num_expl_f_evals = 0;
         this->_num_impl_f_evals = 0;
         this->_num_impl_solves = 0;
+        this->_num_skipped_evaluations = 0;
       }
 
       template<class SweeperTrait, typename Enabled>
@@ -440,20 +443,18 @@ namespace pfasst
       }*/
 
       template<class SweeperTrait, typename Enabled>
-      shared_ptr<typename SweeperTrait::encap_t>
+      void
       Heat_FE<SweeperTrait, Enabled>::evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
-                                                       const shared_ptr<typename SweeperTrait::encap_t> u)
+                                                       const shared_ptr<typename SweeperTrait::encap_t> u,
+                                                       shared_ptr<typename SweeperTrait::encap_t> result)
       {
 	
          ML_CVLOG(4, this->get_logger_id(),  "evaluating IMPLICIT part at t=" << t);
 
 
 
-        auto result = this->get_encap_factory().create();
-        auto u2 = this->get_encap_factory().create();
         double nu =this->_nu;
 
-	u2->zero();
 	for (int i=0; i<u->get_data().size(); ++i)
 	    {
 	    result->data()[i]= -pow(u->get_data()[i], _n+1) * (*w)[i];	
@@ -473,7 +474,6 @@ namespace pfasst
 
          }*/
         
-        return result;
       }
 
       template<class SweeperTrait, typename Enabled>
@@ -484,6 +484,8 @@ namespace pfasst
                                                     const typename SweeperTrait::time_t& dt,
                                                     const shared_ptr<typename SweeperTrait::encap_t> rhs)
       {
+        // per-solve copy of the forcing state; nodes may be solved concurrently
+        auto newton = this->_newton;
 	
 
 
@@ -500,10 +502,15 @@ namespace pfasst
     newton_rhs2.resize(rhs->get_data().size());
     
 	
-        u->zero();
+        // u holds the initial guess prepared by IMEX::initial_guess()
 	for (int i=0; i< 200 ;i++){
 	  Dune::BCRSMatrix<Dune::FieldMatrix<double,1,1> > df = Dune::BCRSMatrix<Dune::FieldMatrix<double,1,1> >(this->M_dune); ///////M
 	  evaluate_f(f, u, dt, rhs);
+	  const spatial_t f_norm = f->norm0();
+	  if (i == 0) {
+	    newton.start(f_norm, this->get_status()->get_abs_res_norm(), this->is_coarse);
+	  }
+	  if (newton.is_enabled() && newton.converged(f_norm)) { break; }
 	  evaluate_df(df, u, dt);
 	  df.mv(u->data(), newton_rhs);
 	  newton_rhs -= f->data();
@@ -541,10 +548,11 @@ namespace pfasst
 
           std::cout << "vor solver" << std::endl;  
 	  Dune::MatrixAdapter<MatrixType,VectorType,VectorType> linearOperator(df);
-	  Dune::SeqILU0<MatrixType,VectorType,VectorType> preconditioner(df,1.0);
+	  auto preconditioner = make_preconditioner<MatrixType,VectorType>(this->_impl_operators.get_preconditioner(),
+	                                                                   df, linearOperator);
 	  Dune::CGSolver<VectorType> cg(linearOperator,
-                              preconditioner,
-                              1e-16, // desired residual reduction factor
+                              *preconditioner,
+                              newton.forcing(f_norm), // desired residual reduction factor
                               5000,    // maximum number of iterations
                               1);    // verbosity of the solver
 	  Dune::InverseOperatorResult statistics ;
@@ -566,7 +574,7 @@ namespace pfasst
           evaluate_f(f, u, dt, rhs);
           
           std::cout << i << " residuumsnorm von f(u) " << f->norm0() << std::endl;  
-          if(f->norm0()<1e-10){   std::cout << "genauigkeit erreicht " << i << std::endl;      break;} //  std::exit(0); std::cout << "genauigkeit erreicht " << i << std::endl;
+          if(newton.converged(f->norm0())){   std::cout << "genauigkeit erreicht " << i << std::endl;      break;} //  std::exit(0); std::cout << "genauigkeit erreicht " << i << std::endl;
           
 	  df.mv(u->data(), residuum->data());
           residuum->data() -= newton_rhs2;
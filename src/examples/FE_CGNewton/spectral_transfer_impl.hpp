@@ -67,12 +67,10 @@ namespace pfasst
 	    
 	    restrict_matrix   = restrict;
 
-	    for (int i=0; i< restrict_matrix.N(); i++){
-	      for (int j=0; j< restrict_matrix.M(); j++){
-		if(restrict_matrix.exists(i,j)){	
-		  if (restrict_matrix[i][j]==0.5 ) restrict_matrix[i][j]=0;
-		}
-
+	    // drop the 0.5 weights, visiting the stored entries only
+	    for (auto row = restrict_matrix.begin(); row != restrict_matrix.end(); ++row) {
+	      for (auto col = row->begin(); col != row->end(); ++col) {
+		if (*col == 0.5) *col = 0;
 	      }
 	    }
 	    
@@ -70,6 +70,7 @@ namespace pfasst
 
 
         auto FinEl = make_shared<fe_manager>(nelements, 2);
+        Dune::Timer startup_timer;
 
         using pfasst::quadrature::quadrature_factory;
 
@@ -84,8 +85,11 @@ namespace pfasst
         coarse->is_coarse=true;
         fine->is_coarse=false;
         
+        FinEl->add_startup_time("assembly", startup_timer.elapsed());
+        startup_timer.reset();
         auto transfer = std::make_shared<transfer_t>();
         transfer->create(FinEl);
+        FinEl->add_startup_time("transfer", startup_timer.elapsed());
 	
         //mlsdc->add_sweeper(coarse, true);
         //mlsdc->add_sweeper(fine, false);
@@ -113,7 +117,10 @@ namespace pfasst
 
 
 
+        startup_timer.reset();
         mlsdc->setup();
+        FinEl->add_startup_time("sweeper setup", startup_timer.elapsed());
+        FinEl->report_startup();
 
 
         coarse->initial_state() = coarse->exact(mlsdc->get_status()->get_time());
@@ -78,6 +78,7 @@ namespace pfasst
         pfasst.communicator() = std::make_shared<CommunicatorType>(MPI_COMM_WORLD);
         //pfasst.grid_builder(nelements);
 	auto FinEl = make_shared<fe_manager>(nelements, 2);
+        Dune::Timer startup_timer;
 
         
 
@@ -90,8 +91,11 @@ namespace pfasst
         coarse->is_coarse=true;
         fine->is_coarse=false;
 
+        FinEl->add_startup_time("assembly", startup_timer.elapsed());
+        startup_timer.reset();
         auto transfer = std::make_shared<TransferType>();
 	transfer->create(FinEl);
+        FinEl->add_startup_time("transfer", startup_timer.elapsed());
         
         fine->set_abs_residual_tol(1e-12);
         coarse->set_abs_residual_tol(1e-12);
@@ -112,7 +116,10 @@ namespace pfasst
         pfasst.status()->t_end() = t_end;
         pfasst.status()->max_iterations() = niter;
 
+        startup_timer.reset();
         pfasst.setup();
+        FinEl->add_startup_time("sweeper setup", startup_timer.elapsed());
+        FinEl->report_startup();
 
         coarse->initial_state() = coarse->exact(pfasst.get_status()->get_time());
         fine->initial_state() = fine->exact(pfasst.get_status()->get_time());
@@ -62,10 +62,13 @@ namespace pfasst
         auto sdc = std::make_shared<heat_FE_sdc_t>();
 	
         auto FinEl   = make_shared<fe_manager>(nelements,1); 
+        Dune::Timer startup_timer;
 
         //auto sweeper = std::make_shared<sweeper_t>(FinEl->get_basis2(), 0, FinEl->get_grid());
         auto sweeper = std::make_shared<sweeper_t>(FinEl->get_basis(0), 0, FinEl->get_grid());
 
+        FinEl->add_startup_time("assembly", startup_timer.elapsed());
+
         sweeper->quadrature() = quadrature_factory<double>(nnodes, quad_type);
 
         sweeper->set_abs_residual_tol(1e-6);
@@ -78,7 +81,10 @@ namespace pfasst
         sdc->status()->t_end() = t_end;
         sdc->status()->max_iterations() = niter;
 
+        startup_timer.reset();
         sdc->setup();
+        FinEl->add_startup_time("sweeper setup", startup_timer.elapsed());
+        FinEl->report_startup();
 
         sweeper->initial_state() = sweeper->exact(sdc->get_status()->get_time());
         Dune::BlockVector<Dune::FieldVector<double, 1> > w = sweeper->initial_state()->data();
@@ -1,7 +1,10 @@
 #ifndef _PFASST__EXAMPLES__HEAD2D__HEAD2D_SWEEPER_HPP_
 #define _PFASST__EXAMPLES__HEAD2D__HEAD2D_SWEEPER_HPP_
 
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 
 using std::shared_ptr;
@@ -11,12 +14,14 @@ using std::vector;
 
 //#include <pfasst/sweeper/FE_imex.hpp>
 #include <pfasst/sweeper/FE_impl.hpp>
+#include <pfasst/sweeper/inexact_newton.hpp>
 //#include <pfasst/sweeper/imex.hpp>
 
 #include <pfasst/contrib/fft.hpp>
 //#include "../../finite_element_stuff/fe_manager_fp.hpp"
 
 #include "fe_manager.hpp"
+#include "shared_operators.hpp"
 
 
 //using namespace Dune;
@@ -78,6 +83,44 @@ namespace pfasst
           double                                     	 _n{2.0};
           double                                      	 _delta{1.0};
           double                                         _abs_newton_tol=1e-10;
+          //! Newton stopping tolerance and forcing terms (`newton_inexact`)
+          pfasst::InexactNewton<double>                  _newton{1e-10, 1e-16};
+
+          /**
+           * When to reassemble the Newton Jacobian.
+           *
+           * Set via the runtime parameter `newton_jacobian` (`full`, `chord_node`, `chord_sweep` or
+           * `adaptive`).
+           */
+          enum class jacobian_policy_t {
+            //! every Newton iteration
+            FULL,
+            //! once per implicit solve, i.e. per node and sweep
+            CHORD_NODE,
+            //! once per sweep for each node
+            CHORD_SWEEP,
+            //! only when the contraction rate of the Newton iteration exceeds `newton_refresh_rate`
+            ADAPTIVE
+          };
+
+          //! Newton Jacobian and its preconditioner for one implicit coefficient @f$ \Delta t \tilde{q}_{mm} @f$.
+          struct jacobian_t
+          {
+            MatrixType                                                  df;
+            shared_ptr<Dune::MatrixAdapter<MatrixType,VectorType,VectorType>> op;
+            shared_ptr<Dune::Preconditioner<VectorType,VectorType>>     preconditioner;
+            size_t                                                      sweep = 0;
+            bool                                                        valid = false;
+          };
+
+          jacobian_policy_t                                    _jacobian_policy{jacobian_policy_t::FULL};
+          double                                               _newton_refresh_rate{0.5};
+          std::map<typename traits::time_t, jacobian_t>        _jacobians;
+          typename traits::time_t                              _jacobian_step_width{0.0};
+          size_t                                               _newton_sweep{0};
+          std::atomic<size_t>                                  _num_jacobian_updates{0};
+          //! guards `_jacobians` against concurrent lookups of a node-parallel sweep
+          std::mutex                                           _jacobians_mutex;
 
 
 
@@ -86,7 +129,22 @@ namespace pfasst
 
 
 	  std::shared_ptr<fe_manager> FinEl;
+          //! lumped mass matrix, i.e. the row sums of `M_dune`
           std::shared_ptr<VectorType> w; 
+
+          /**
+           * @name Node-wide operators
+           * With the runtime parameter `shared_operators` all ranks of a node use one copy of `M_dune`,
+           * `A_dune` and `w`, assembled by the first rank of the node; the private ones stay empty.
+           * Everything outside this sweeper, e.g. the transfer, multiplies through mass_mv().
+           * @{
+           */
+          std::shared_ptr<SharedMatrix>                  _M_shared;
+          std::shared_ptr<SharedMatrix>                  _A_shared;
+          std::shared_ptr<SharedVector>                  _w_shared;
+          //! @}
+          //! entries of the lumped mass, private or shared
+          const double*                                  _lumped_mass{nullptr};
 	  
 	  
 	  //________________________________________________________
@@ -116,9 +174,11 @@ namespace pfasst
           evaluate_rhs_expl(const typename SweeperTrait::time_t& t,
                             const shared_ptr<typename SweeperTrait::encap_t> u) override;*/
 
-          virtual shared_ptr<typename SweeperTrait::encap_t>
+          using IMEX<SweeperTrait, Enabled>::evaluate_rhs_impl;
+          virtual void
           evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
-                            const shared_ptr<typename SweeperTrait::encap_t> u) override;
+                            const shared_ptr<typename SweeperTrait::encap_t> u,
+                            shared_ptr<typename SweeperTrait::encap_t> result) override;
 
           virtual void implicit_solve(shared_ptr<typename SweeperTrait::encap_t> f,
                                       shared_ptr<typename SweeperTrait::encap_t> u,
@@ -126,6 +186,19 @@ namespace pfasst
                                       const typename SweeperTrait::time_t& dt,
                                       const shared_ptr<typename SweeperTrait::encap_t> rhs) override;
 
+          //! @{
+          //! Products and sums with `M_dune` and `A_dune`, wherever they are stored.
+          void mass_umv(const VectorType& x, VectorType& y) const;
+          void stiffness_umv(const VectorType& x, VectorType& y) const;
+          void stiffness_mmv(const VectorType& x, VectorType& y) const;
+          //! @p df becomes a private copy of the mass matrix; @p df has to be freshly constructed
+          void copy_mass(MatrixType& df) const;
+          //! @f$ df \mathrel{+}= \alpha M @f$ for @p df with the sparsity pattern of the mass matrix
+          void add_mass(MatrixType& df, const double alpha) const;
+          //! @f$ df \mathrel{+}= \alpha A @f$ for @p df with the sparsity pattern of the mass matrix
+          void add_stiffness(MatrixType& df, const double alpha) const;
+          //! @}
+
           virtual vector<shared_ptr<typename SweeperTrait::encap_t>>
           compute_error(const typename SweeperTrait::time_t& t);
 
@@ -140,6 +213,19 @@ namespace pfasst
 						 const shared_ptr<typename SweeperTrait::encap_t> rhs
 						);
 						
+	  /**
+	   * Newton Jacobian for the coefficient @p dt, reassembled in place if the policy demands it.
+	   *
+	   * @param[in] first_iteration  whether this is the first Newton iteration of the current solve
+	   * @param[in] rate             contraction rate @f$ \|f(u_k)\| / \|f(u_{k-1})\| @f$ of the last
+	   *                             Newton iteration (zero in the first one)
+	   */
+	  virtual jacobian_t&
+	  newton_jacobian(const shared_ptr<typename SweeperTrait::encap_t> u,
+	                  const typename SweeperTrait::time_t& dt,
+	                  const bool first_iteration,
+	                  const typename traits::spatial_t rate);
+
 	  virtual void					
 	  evaluate_df(Dune::BCRSMatrix<Dune::FieldMatrix<double,1,1> > &df,
                                                  const shared_ptr<typename SweeperTrait::encap_t> u,
@@ -162,6 +248,7 @@ namespace pfasst
 	  //virtual shared_ptr<typename SweeperTrait::encap_t> source(const typename SweeperTrait::time_t& t);
 	  
 	  
+          virtual void pre_sweep() override;
           virtual void post_step() override;
 
           virtual bool converged(const bool pre_check) override;
@@ -169,7 +256,22 @@ namespace pfasst
 
           size_t get_num_dofs() const;
 
-          auto get_A_dune() const {
+          virtual void mass_mv(const VectorType& x, VectorType& y) const override;
+          virtual void mass_mmv(const VectorType& x, VectorType& y) const override;
+
+          //! private copy of the mass matrix; products are cheaper with mass_mv()
+          shared_ptr<MatrixType> get_M_dune() const {
+            auto M = std::make_shared<MatrixType>();
+            this->copy_mass(*M);
+            return M;
+          }
+          //! private copy of the stiffness matrix
+          MatrixType get_A_dune() const {
+            if (this->_A_shared) {
+              MatrixType A;
+              this->_A_shared->copy_to(A);
+              return A;
+            }
             return this->A_dune;
           }
           //shared_ptr<GridType> get_grid() const;
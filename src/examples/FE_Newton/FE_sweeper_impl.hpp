@@ -1,6 +1,8 @@
 #include "FE_sweeper.hpp"
 
 #include "assemble.hpp"
+#include "matrix_cache.hpp"
+#include "shared_operators.hpp"
 
 #include <algorithm>
 #include <cassert>
@@ -140,20 +142,45 @@ namespace pfasst
 
         this->grid = grid;
 	
-        assembleProblem(basis, this->A_dune, this->M_dune);
+        // with shared operators only the first rank of each node assembles
+        const bool shared = config::get_value<bool>("shared_operators", false);
+
+        if (!shared || SharedSegment::is_leader()) {
+          // identical on all ranks and runs with the same grid, thus shared through the matrix cache
+          const MatrixCache cache(config::get_value<std::string>("matrix_cache", ""));
+          const std::string key = "FE_Newton assembleProblem "
+                                  + StiffnessMassKernel<SweeperTrait::DIM>::describe(SweeperTrait::BASE_ORDER)
+                                  + " " + describe_basis(*basis);
+          if (!cache.load(key, std::vector<MatrixType*>{&this->A_dune, &this->M_dune})) {
+            assembleProblem(basis, this->A_dune, this->M_dune);
+            cache.store(key, std::vector<const MatrixType*>{&this->A_dune, &this->M_dune});
+          }
+
+          w = std::make_shared<VectorType>(this->M_dune.M());
+          for(int j=0; j<this->M_dune.M(); j++){
+              (*w)[j]=0;
+          }
 
-        stiffnessMatrix = this->A_dune;
-        stiffnessMatrix *= -1;
-        w = std::make_shared<VectorType>(this->M_dune.M());
-        for(int j=0; j<this->M_dune.M(); j++){
-            (*w)[j]=0;
+          // lumped mass: row sums over the stored entries of M only
+          for (auto row = this->M_dune.begin(); row != this->M_dune.end(); ++row) {
+              for (auto col = row->begin(); col != row->end(); ++col) {
+                  (*w)[row.index()][0] += (*col)[0][0];
+              }
+          }
         }
 
-        for(int i=0; i<this->M_dune.M(); i++){
-            for(int j=0; j<this->M_dune.M(); j++){
-                if(this->M_dune.exists(i,j))
-                (*w)[i][0]= ((double) (*w)[i][0]) + ((double) this->M_dune[i][j][0][0]);
-            }
+        if (shared) {
+          this->_M_shared = std::make_shared<SharedMatrix>(SharedMatrix::share(&this->M_dune));
+          this->_A_shared = std::make_shared<SharedMatrix>(SharedMatrix::share(&this->A_dune));
+          this->_w_shared = std::make_shared<SharedVector>(SharedVector::share(w.get()));
+          this->M_dune = MatrixType();
+          this->A_dune = MatrixType();
+          w = nullptr;
+          this->_lumped_mass = this->_w_shared->data();
+        } else {
+          stiffnessMatrix = this->A_dune;
+          stiffnessMatrix *= -1;
+          this->_lumped_mass = &(*w)[0][0];
         }
 
         const auto bs = basis->size();
@@ -173,6 +200,25 @@ namespace pfasst
         IMEX<SweeperTrait, Enabled>::set_options();
 
         this->_nu = config::get_value<spatial_t>("nu", this->_nu);
+        this->_newton.set_options();
+
+        const string policy = config::get_value<string>("newton_jacobian", "full");
+        if (policy == "full") {
+          this->_jacobian_policy = jacobian_policy_t::FULL;
+        } else if (policy == "chord_node") {
+          this->_jacobian_policy = jacobian_policy_t::CHORD_NODE;
+        } else if (policy == "chord_sweep") {
+          this->_jacobian_policy = jacobian_policy_t::CHORD_SWEEP;
+        } else if (policy == "adaptive") {
+          this->_jacobian_policy = jacobian_policy_t::ADAPTIVE;
+        } else {
+          ML_CLOG(ERROR, this->get_logger_id(), "unknown Newton Jacobian policy '" << policy
+                                                << "' (expected full, chord_node, chord_sweep or adaptive)");
+          throw std::runtime_error("unknown Newton Jacobian policy: " + policy);
+        }
+        this->_newton_refresh_rate = config::get_value<double>("newton_refresh_rate", this->_newton_refresh_rate);
+        ML_CVLOG(3, this->get_logger_id(), "  Newton Jacobian policy:      " << policy
+                                            << " (refresh rate " << this->_newton_refresh_rate << ")");
 
         int num_nodes = this->get_quadrature()->get_num_nodes();
 
@@ -300,6 +346,21 @@ namespace pfasst
       
       
 
+      template<class SweeperTrait, typename Enabled>
+      void
+      Heat_FE<SweeperTrait, Enabled>::pre_sweep()
+      {
+        IMEX<SweeperTrait, Enabled>::pre_sweep();
+
+        // Jacobians are kept per dt * q_mm; a new step width renders all of them useless
+        const auto dt = this->get_status()->get_dt();
+        if (dt != this->_jacobian_step_width) {
+          this->_jacobians.clear();
+          this->_jacobian_step_width = dt;
+        }
+        this->_newton_sweep++;
+      }
+
       template<class SweeperTrait, typename Enabled>
       void
       Heat_FE<SweeperTrait, Enabled>::post_step()
@@ -310,10 +371,14 @@ namespace pfasst
         //ML_CLOG(INFO, this->get_logger_id(), "  expl:        " << this->_num_expl_f_evals);
         ML_CLOG(INFO, this->get_logger_id(), "  impl:        " << this->_num_impl_f_evals);
         ML_CLOG(INFO, this->get_logger_id(), "  impl solves: " << this->_num_impl_solves);
+        ML_CLOG(INFO, this->get_logger_id(), "  skipped:     " << this->_num_skipped_evaluations);
+        ML_CLOG(INFO, this->get_logger_id(), "  Jacobians:   " << this->_num_jacobian_updates);
 
         //this->_num_expl_f_evals = 0;
         this->_num_impl_f_evals = 0;
         this->_num_impl_solves = 0;
+        this->_num_skipped_evaluations = 0;
+        this->_num_jacobian_updates = 0;
       }
 
       template<class SweeperTrait, typename Enabled>
@@ -455,30 +520,28 @@ namespace pfasst
       }*/
 
       template<class SweeperTrait, typename Enabled>
-      shared_ptr<typename SweeperTrait::encap_t>
+      void
       Heat_FE<SweeperTrait, Enabled>::evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
-                                                       const shared_ptr<typename SweeperTrait::encap_t> u)
+                                                       const shared_ptr<typename SweeperTrait::encap_t> u,
+                                                       shared_ptr<typename SweeperTrait::encap_t> result)
       {
 	
          ML_CVLOG(4, this->get_logger_id(),  "evaluating IMPLICIT part at t=" << t);
 
 
 
-        auto result = this->get_encap_factory().create();
-        auto u2 = this->get_encap_factory().create();
         double nu =this->_nu;
 
-	u2->zero();
 	for (int i=0; i<u->get_data().size(); ++i)
         {
-	    result->data()[i]= -pow(u->get_data()[i], _n+1) * (*w)[i];	
+	    result->data()[i]= -pow(u->get_data()[i], _n+1) * _lumped_mass[i];	
 	}
 	    
 	    
 
-	this->M_dune.umv(u->get_data(), result->data());
+	this->mass_umv(u->get_data(), result->data());
 	result->data()*=_nu*_nu;
-	this->A_dune.umv(u->get_data(), result->data());
+	this->stiffness_umv(u->get_data(), result->data());
 
 	
 
@@ -490,7 +553,6 @@ namespace pfasst
 
          }*/
         
-        return result;
       }
 
       
@@ -504,6 +566,8 @@ namespace pfasst
                                                     const typename SweeperTrait::time_t& dt,
                                                     const shared_ptr<typename SweeperTrait::encap_t> rhs)
       {
+        // per-solve copy of the forcing state; nodes may be solved concurrently
+        auto newton = this->_newton;
 	
 
          ML_CVLOG(4, this->get_logger_id(),
@@ -515,14 +579,24 @@ namespace pfasst
         newton_rhs2.resize(rhs->get_data().size());
     
 	
-        u->zero();
+        // u holds the initial guess prepared by IMEX::initial_guess()
+        spatial_t f_norm_prev = 0.0;
 	for (int i=0; i< 200 ;i++){
             
           std::cout << "schleife " << std::endl;
   
-	  Dune::BCRSMatrix<Dune::FieldMatrix<double,1,1> > df = Dune::BCRSMatrix<Dune::FieldMatrix<double,1,1> >(this->M_dune); ///////M
 	  evaluate_f(f, u, dt, rhs);
-	  evaluate_df(df, u, dt);
+	  const spatial_t f_norm = f->norm0();
+	  const spatial_t rate = (i > 0 && f_norm_prev > 0.0) ? f_norm / f_norm_prev : 0.0;
+	  f_norm_prev = f_norm;
+
+	  if (i == 0) {
+	    newton.start(f_norm, this->get_status()->get_abs_res_norm(), this->is_coarse);
+	  }
+	  if (newton.is_enabled() && newton.converged(f_norm)) { break; }
+
+	  auto& jacobian = this->newton_jacobian(u, dt, i == 0, rate);
+	  const MatrixType& df = jacobian.df;
 	  df.mv(u->data(), newton_rhs);
 	  newton_rhs -= f->data();
           newton_rhs2 = newton_rhs;
@@ -613,13 +687,10 @@ namespace pfasst
 
           std::cout << "vor solver" << std::endl;
           
-	  Dune::MatrixAdapter<MatrixType,VectorType,VectorType> linearOperator(df);
 	  
-          Dune::SeqILU0<MatrixType,VectorType,VectorType> preconditioner(df,1.0);
-	  
-          Dune::CGSolver<VectorType> cg(linearOperator,
-                              preconditioner,
-                              1e-16, // desired residual reduction factor
+          Dune::CGSolver<VectorType> cg(*(jacobian.op),
+                              *(jacobian.preconditioner),
+                              newton.forcing(f_norm), // desired residual reduction factor
                               5000,    // maximum number of iterations
                               1);    // verbosity of the solver
           
@@ -650,7 +721,7 @@ namespace pfasst
           evaluate_f(f, u, dt, rhs);
           
           std::cout << i << " residuumsnorm von f(u) " << f->norm0() << std::endl;  
-          if(f->norm0()<1e-10){   std::cout << "genauigkeit erreicht " << i << std::endl;      break;} //  std::exit(0); std::cout << "genauigkeit erreicht " << i << std::endl;
+          if(newton.converged(f->norm0())){   std::cout << "genauigkeit erreicht " << i << std::endl;      break;} //  std::exit(0); std::cout << "genauigkeit erreicht " << i << std::endl;
           
 	  df.mv(u->data(), residuum->data());
           residuum->data() -= newton_rhs2;
@@ -677,7 +748,7 @@ namespace pfasst
 	
 	Dune::BlockVector<Dune::FieldVector<double,1> > M_u;
         M_u.resize(u->get_data().size());
-	this->M_dune.mv(u->get_data(), M_u);
+	this->mass_mv(u->get_data(), M_u);
 
 //std::cout << "impl solve "  << std::endl;
         for (size_t i = 0; i < u->get_data().size(); i++) {
@@ -906,16 +977,16 @@ namespace pfasst
           fneu.resize(u->get_data().size());
           for (int i=0; i<u->get_data().size(); ++i)
           {
-            f->data()[i]= pow(u->get_data()[i], _n+1) * (*w)[i];	
+            f->data()[i]= pow(u->get_data()[i], _n+1) * _lumped_mass[i];	
           }
-          this->M_dune.mmv(u->get_data(), f->data());
+          this->mass_mmv(u->get_data(), f->data());
 
           f->data() *= (_nu*_nu);
 
 
-          this->A_dune.mmv(u->get_data(),f->data());
+          this->stiffness_mmv(u->get_data(),f->data());
           f->data() *= dt;
-          this->M_dune.umv(u->get_data(),f->data());
+          this->mass_umv(u->get_data(),f->data());
           f->data() -=rhs->get_data();
 
 	
@@ -937,6 +1008,57 @@ namespace pfasst
 
       }
 						
+      template<class SweeperTrait, typename Enabled>
+      typename Heat_FE<SweeperTrait, Enabled>::jacobian_t&
+      Heat_FE<SweeperTrait, Enabled>::newton_jacobian(const shared_ptr<typename SweeperTrait::encap_t> u,
+                                                     const typename SweeperTrait::time_t& dt,
+                                                     const bool first_iteration,
+                                                     const typename traits::spatial_t rate)
+      {
+        std::unique_lock<std::mutex> lock(this->_jacobians_mutex);
+        auto& jacobian = this->_jacobians[dt];
+        lock.unlock();
+
+        bool refresh = !jacobian.valid;
+        switch (this->_jacobian_policy) {
+          case jacobian_policy_t::FULL:
+            refresh = true;
+            break;
+          case jacobian_policy_t::CHORD_NODE:
+            refresh = refresh || first_iteration;
+            break;
+          case jacobian_policy_t::CHORD_SWEEP:
+            refresh = refresh || (jacobian.sweep != this->_newton_sweep);
+            break;
+          case jacobian_policy_t::ADAPTIVE:
+            refresh = refresh || (rate > this->_newton_refresh_rate);
+            break;
+        }
+
+        if (refresh) {
+          if (!jacobian.valid) {
+            // allocates the sparsity pattern of M once; evaluate_df never leaves it
+            this->copy_mass(jacobian.df);
+          } else {
+            jacobian.df = 0.0;
+            this->add_mass(jacobian.df, 1.0);
+          }
+          evaluate_df(jacobian.df, u, dt);
+          if (!jacobian.op) {
+            jacobian.op = std::make_shared<Dune::MatrixAdapter<MatrixType,VectorType,VectorType>>(jacobian.df);
+          }
+          jacobian.preconditioner = make_preconditioner<MatrixType,VectorType>(this->_impl_operators.get_preconditioner(),
+                                                                               jacobian.df, *(jacobian.op));
+          jacobian.sweep = this->_newton_sweep;
+          jacobian.valid = true;
+          this->_num_jacobian_updates++;
+
+          ML_CVLOG(5, this->get_logger_id(), "reassembled Newton Jacobian for dt=" << dt << " (rate=" << rate << ")");
+        }
+
+        return jacobian;
+      }
+
       template<class SweeperTrait, typename Enabled>
       void
       Heat_FE<SweeperTrait, Enabled>::evaluate_df(Dune::BCRSMatrix<Dune::FieldMatrix<double,1,1> > &df,
@@ -950,18 +1072,106 @@ namespace pfasst
           
             for (int i=0; i<df.N(); ++i)
             {
-                df[i][i]= (_nu*_nu)*(_n+1) * pow(u->get_data()[i], _n) * ((double) (*w)[i]);	
+                df[i][i]= (_nu*_nu)*(_n+1) * pow(u->get_data()[i], _n) * _lumped_mass[i];	
             }
-            df.axpy((-_nu*_nu), this->M_dune);
-            df-=this->A_dune;
+            this->add_mass(df, -_nu*_nu);
+            this->add_stiffness(df, -1.0);
             df*=dt;
-            df+=this->M_dune;
+            this->add_mass(df, 1.0);
           
           
           
 
 
       }  
+
+      template<class SweeperTrait, typename Enabled>
+      void
+      Heat_FE<SweeperTrait, Enabled>::mass_mv(const VectorType& x, VectorType& y) const
+      {
+        if (this->_M_shared) {
+          this->_M_shared->mv(x, y);
+        } else {
+          this->M_dune.mv(x, y);
+        }
+      }
+
+      template<class SweeperTrait, typename Enabled>
+      void
+      Heat_FE<SweeperTrait, Enabled>::mass_mmv(const VectorType& x, VectorType& y) const
+      {
+        if (this->_M_shared) {
+          this->_M_shared->mmv(x, y);
+        } else {
+          this->M_dune.mmv(x, y);
+        }
+      }
+
+      template<class SweeperTrait, typename Enabled>
+      void
+      Heat_FE<SweeperTrait, Enabled>::mass_umv(const VectorType& x, VectorType& y) const
+      {
+        if (this->_M_shared) {
+          this->_M_shared->umv(x, y);
+        } else {
+          this->M_dune.umv(x, y);
+        }
+      }
+
+      template<class SweeperTrait, typename Enabled>
+      void
+      Heat_FE<SweeperTrait, Enabled>::stiffness_umv(const VectorType& x, VectorType& y) const
+      {
+        if (this->_A_shared) {
+          this->_A_shared->umv(x, y);
+        } else {
+          this->A_dune.umv(x, y);
+        }
+      }
+
+      template<class SweeperTrait, typename Enabled>
+      void
+      Heat_FE<SweeperTrait, Enabled>::stiffness_mmv(const VectorType& x, VectorType& y) const
+      {
+        if (this->_A_shared) {
+          this->_A_shared->mmv(x, y);
+        } else {
+          this->A_dune.mmv(x, y);
+        }
+      }
+
+      template<class SweeperTrait, typename Enabled>
+      void
+      Heat_FE<SweeperTrait, Enabled>::copy_mass(MatrixType& df) const
+      {
+        if (this->_M_shared) {
+          this->_M_shared->copy_to(df);
+        } else {
+          df = this->M_dune;
+        }
+      }
+
+      template<class SweeperTrait, typename Enabled>
+      void
+      Heat_FE<SweeperTrait, Enabled>::add_mass(MatrixType& df, const double alpha) const
+      {
+        if (this->_M_shared) {
+          this->_M_shared->add_to(df, alpha);
+        } else {
+          df.axpy(alpha, this->M_dune);
+        }
+      }
+
+      template<class SweeperTrait, typename Enabled>
+      void
+      Heat_FE<SweeperTrait, Enabled>::add_stiffness(MatrixType& df, const double alpha) const
+      {
+        if (this->_A_shared) {
+          this->_A_shared->add_to(df, alpha);
+        } else {
+          df.axpy(alpha, this->A_dune);
+        }
+      }
       
       
     }  // ::pfasst::examples::heat1
@@ -4,6 +4,7 @@
 #include <dune/common/function.hh>
 
 #include <dune/geometry/quadraturerules.hh>
+#include <dune/geometry/referenceelements.hh>
 
 #include <dune/grid/yaspgrid.hh>
 
@@ -19,8 +20,19 @@
 #include <dune/functions/functionspacebases/lagrangedgbasis.hh>
 #include <dune/functions/functionspacebases/interpolate.hh>
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
 #include <vector>
 
+#include <pfasst/config.hpp>
+#include <pfasst/node_pool.hpp>
+
 
 
 
@@ -148,65 +160,335 @@ void getOccupationPattern(const Basis &basis, Dune::MatrixIndexSet &nb) {
 
 
 
+/**
+ * Element loop of the finite element assembly, run on several threads.
+ *
+ * The elements are greedily coloured such that no two elements of one colour share a degree of
+ * freedom.
+ * Colour by colour, the elements are then assembled concurrently and scattered into the global
+ * matrices without any locking, as every row is written by at most one element of a colour.
+ * Occupation pattern and colouring are built once per basis; the element matrices and the local
+ * view are scratch of each task.
+ *
+ * The element integrals are given as a kernel, thus the same assembler serves the operators of
+ * the problem as well as e.g. the Jacobian of a Newton solver.
+ */
 template<class Basis>
-void assembleProblem(const Basis &basis,
-                            Dune::BCRSMatrix <Dune::FieldMatrix<double, 1, 1>> &A,
-                            Dune::BCRSMatrix <Dune::FieldMatrix<double, 1, 1>> &M){
-                            //Dune::DenseMatrix<Dune::FieldMatrix<double,1,1>> M_inverse) {
+class ColoredAssembler {
+
+  using GridView = typename Basis::GridView;
+  using Element = typename GridView::template Codim<0>::Entity;
+  using ElementSeed = typename Element::EntitySeed;
+
+  std::shared_ptr<Basis> basis;
+  Dune::MatrixIndexSet pattern;
+  std::vector<std::vector<ElementSeed>> colors;
+  std::shared_ptr<pfasst::NodePool> pool;
+
+public:
+  using ElementMatrix = Dune::Matrix<Dune::FieldMatrix<double, 1, 1>>;
+
+  //! @param[in] num_threads  threads assembling concurrently; 1 runs the element loop on the calling thread
+  ColoredAssembler(const std::shared_ptr<Basis> &basis, const size_t num_threads)
+    : basis(basis), pool(num_threads > 1 ? std::make_shared<pfasst::NodePool>(num_threads) : nullptr)
+  {
+    getOccupationPattern(basis, pattern);
+
+    // colours already taken by an element around each degree of freedom
+    std::vector<std::uint64_t> taken(basis->size(), 0);
+    auto localView = basis->localView();
+    auto localIndexSet = basis->localIndexSet();
+    for (const auto &element : elements(basis->gridView())) {
+      localView.bind(element);
+      localIndexSet.bind(localView);
+
+      std::uint64_t used = 0;
+      for (size_t i = 0; i < localIndexSet.size(); i++)
+        used |= taken[localIndexSet.index(i)];
+      if (~used == 0)
+        throw std::runtime_error("element colouring needs more than 64 colours");
+
+      size_t color = 0;
+      while (used & (std::uint64_t(1) << color))
+        color++;
+      for (size_t i = 0; i < localIndexSet.size(); i++)
+        taken[localIndexSet.index(i)] |= std::uint64_t(1) << color;
+
+      if (color >= colors.size())
+        colors.resize(color + 1);
+      colors[color].push_back(element.seed());
+    }
+  }
 
-  using namespace Dune;
+  size_t num_colors() const { return colors.size(); }
+
+  //! Sets up the sparsity pattern of @p matrix; entries are left uninitialised.
+  template<class MatrixType>
+  void exportPattern(MatrixType &matrix) const { pattern.exportIdx(matrix); }
+
+  /**
+   * Adds the element matrices computed by @p kernel to @p targets.
+   *
+   * @p kernel is called as `kernel(localView, elementMatrices)` with one element matrix per target,
+   * indexed by local degrees of freedom; it must fill all of them.
+   * The first element is assembled on the calling thread by a copy of @p kernel, which then serves
+   * as prototype of the per-task copies.
+   * Thus lazily initialised data, like quadrature rules or whatever the kernel caches, is set up
+   * once before any concurrent access.
+   */
+  template<class MatrixType, class Kernel>
+  void assemble(const std::vector<MatrixType*> &targets, const Kernel &kernel) const {
+    const auto gridView = basis->gridView();
+    const size_t num_threads = pool ? pool->size() : 1;
+
+    // assembles elements [begin, end) of a colour with task local scratch
+    auto assembleRange = [&](Kernel &localKernel, const std::vector<ElementSeed> &seeds,
+                             const size_t begin, const size_t end) {
+      auto localView = basis->localView();
+      auto localIndexSet = basis->localIndexSet();
+      std::vector<ElementMatrix> elementMatrices(targets.size());
+
+      for (size_t e = begin; e < end; e++) {
+        localView.bind(gridView.grid().entity(seeds[e]));
+        localIndexSet.bind(localView);
+        localKernel(localView, elementMatrices);
+
+        for (size_t i = 0; i < localIndexSet.size(); i++) {
+          auto row = localIndexSet.index(i);
+          for (size_t j = 0; j < localIndexSet.size(); j++) {
+            auto col = localIndexSet.index(j);
+            for (size_t t = 0; t < targets.size(); t++)
+              (*targets[t])[row][col] += elementMatrices[t][i][j];
+          }
+        }
+      }
+    };
 
+    Kernel prototype = kernel;
 
-  auto gridView = basis->gridView();
+    for (size_t c = 0; c < colors.size(); c++) {
+      const auto &seeds = colors[c];
+      size_t begin = 0;
+      if (c == 0 && !seeds.empty()) {
+        assembleRange(prototype, seeds, 0, 1);
+        begin = 1;
+      }
 
-  MatrixIndexSet occupationPattern;
+      const size_t remaining = seeds.size() - begin;
+      const size_t chunk = std::max<size_t>(64, (remaining + 4 * num_threads - 1) / (4 * num_threads));
+      const size_t num_chunks = (remaining + chunk - 1) / chunk;
+      pfasst::parallel_for(pool, num_chunks, [&](const size_t k) {
+        Kernel localKernel = prototype;
+        assembleRange(localKernel, seeds, begin + k * chunk, std::min(seeds.size(), begin + (k + 1) * chunk));
+      });
+    }
+  }
+};
+
+
+/**
+ * Element kernel of `assembleProblem()` computing stiffness and mass matrix of one element.
+ *
+ * Shape function values and reference gradients at the quadrature points are evaluated once per
+ * geometry type, polynomial order and number of shape functions and cached.
+ * The key only holds values, not the local finite element, which belongs to the node cache of a
+ * single local view; so the cache of the prototype kernel stays valid in the per-task copies of
+ * `ColoredAssembler::assemble()`.
+ * For affine elements the element matrices are kept as well: an element with the same kind of
+ * local finite element and the same Jacobian as the last computed one, i.e. any element of an
+ * equidistant structured grid, simply receives a copy.
+ */
+template<int dim>
+struct StiffnessMassKernel {
+
+  //! revision of the element matrices computed here; bump it whenever they change
+  static const char* version() { return "2"; }
+
+  //! @{
+  //! orders of the quadrature rules for stiffness and mass matrix with shape functions of order @p order
+  static int quadratureOrderA(const int order) { return 2 * (dim * order - 1); }
+  static int quadratureOrderM(const int order) { return 2 * (dim * order); }
+  //! @}
+
+  /**
+   * Matrix cache key part describing the assembly for shape functions of order @p order.
+   *
+   * The matrices do not depend on any problem coefficient, as `nu` and the like are only applied
+   * when the operators are used.
+   */
+  static std::string describe(const int order) {
+    std::ostringstream os;
+    os << "kernel=stiffness_mass/" << version() << " dim=" << dim
+       << " quad_A=" << quadratureOrderA(order) << " quad_M=" << quadratureOrderM(order);
+    return os.str();
+  }
 
-  getOccupationPattern(basis, occupationPattern);
+  //! shape functions of one local finite element evaluated at the quadrature points
+  struct ReferenceData {
+    Dune::GeometryType type;
+    unsigned int order;
+    size_t size;
+    const Dune::QuadratureRule<double, dim>* quad_A;
+    const Dune::QuadratureRule<double, dim>* quad_M;
+    //! per point of `quad_A` the reference gradients
+    std::vector<std::vector<Dune::FieldMatrix<double, 1, dim>>> referenceGradients;
+    //! per point of `quad_M` the shape function values
+    std::vector<std::vector<Dune::FieldVector<double, 1>>> shapeFunctionValues;
+  };
+
+  std::vector<ReferenceData> references;
+  std::vector<Dune::FieldVector<double, dim>> gradients;
+
+  //! last element matrices of an affine element, with the data they are valid for
+  bool affineValid = false;
+  Dune::GeometryType affineType;
+  unsigned int affineOrder = 0;
+  size_t affineSize = 0;
+  //! columns of the inverse transposed Jacobian, valid for any matrix type of the geometry
+  std::array<Dune::FieldVector<double, dim>, dim> affineJacobian;
+  double affineIntegrationElement = 0;
+  Dune::Matrix<Dune::FieldMatrix<double, 1, 1>> affineA, affineM;
+
+  template<class LocalFiniteElement>
+  const ReferenceData& reference(const Dune::GeometryType &type, const LocalFiniteElement &localFiniteElement) {
+    const unsigned int order = localFiniteElement.localBasis().order();
+    const size_t size = localFiniteElement.localBasis().size();
+    for (const auto &ref : references)
+      if (ref.type == type && ref.order == order && ref.size == size)
+        return ref;
+
+    ReferenceData ref;
+    ref.type = type;
+    ref.order = order;
+    ref.size = size;
+    ref.quad_A = &Dune::QuadratureRules<double, dim>::rule(type, quadratureOrderA(order));
+    ref.quad_M = &Dune::QuadratureRules<double, dim>::rule(type, quadratureOrderM(order));
+
+    ref.referenceGradients.resize(ref.quad_A->size());
+    for (size_t pt = 0; pt < ref.quad_A->size(); pt++)
+      localFiniteElement.localBasis().evaluateJacobian((*ref.quad_A)[pt].position(), ref.referenceGradients[pt]);
+
+    ref.shapeFunctionValues.resize(ref.quad_M->size());
+    for (size_t pt = 0; pt < ref.quad_M->size(); pt++)
+      localFiniteElement.localBasis().evaluateFunction((*ref.quad_M)[pt].position(), ref.shapeFunctionValues[pt]);
+
+    references.push_back(std::move(ref));
+    return references.back();
+  }
 
-  occupationPattern.exportIdx(A);
-  occupationPattern.exportIdx(M);
+  template<class LocalView, class ElementMatrix>
+  void operator()(const LocalView &localView, std::vector<ElementMatrix> &elementMatrices) {
 
+    auto element = localView.element();
+    auto geometry = element.geometry();
+    const auto &localFiniteElement = localView.tree().finiteElement();
+    const size_t n = localFiniteElement.size();
 
-  A = 0;
-  M = 0;
+    auto &elementMatrix_A = elementMatrices[0];
+    auto &elementMatrix_M = elementMatrices[1];
 
+    const bool affine = geometry.affine();
+    if (affine) {
+      const auto center = Dune::ReferenceElements<double, dim>::general(element.type()).position(0, 0);
+      const auto jacobian = geometry.jacobianInverseTransposed(center);
+      const auto integrationElement = geometry.integrationElement(center);
 
-  auto localView = basis->localView();
-  auto localIndexSet = basis->localIndexSet();
+      std::array<Dune::FieldVector<double, dim>, dim> columns;
+      for (int c = 0; c < dim; c++) {
+        Dune::FieldVector<double, dim> unit(0);
+        unit[c] = 1;
+        jacobian.mv(unit, columns[c]);
+      }
+
+      const unsigned int order = localFiniteElement.localBasis().order();
+      bool same = affineValid && affineType == element.type() && affineOrder == order && affineSize == n
+                  && affineIntegrationElement == integrationElement;
+      for (int c = 0; same && c < dim; c++)
+        same = affineJacobian[c] == columns[c];
+
+      if (same) {
+        elementMatrix_A = affineA;
+        elementMatrix_M = affineM;
+        return;
+      }
 
+      affineType = element.type();
+      affineOrder = order;
+      affineSize = n;
+      affineJacobian = columns;
+      affineIntegrationElement = integrationElement;
+    }
 
+    const auto &ref = reference(element.type(), localFiniteElement);
 
-  for (const auto &element : elements(gridView)) {
+    elementMatrix_A.setSize(n, n);
+    elementMatrix_M.setSize(n, n);
+    elementMatrix_A = 0;
+    elementMatrix_M = 0;
 
-    localView.bind(element);
-    localIndexSet.bind(localView);
-    Dune::Matrix <FieldMatrix<double, 1, 1>> elementMatrix_A;
-    
-    
-    assembleElementA(localView, elementMatrix_A);
-    Dune::Matrix <FieldMatrix<double, 1, 1>> elementMatrix_M;
-    assembleElementM(localView, elementMatrix_M);
+    const auto &quad_A = *ref.quad_A;
+    gradients.resize(n);
+    for (size_t pt = 0; pt < quad_A.size(); pt++) {
+      const auto quadPos = quad_A[pt].position();
+      const auto jacobian = geometry.jacobianInverseTransposed(quadPos);
+      const auto integrationElement = geometry.integrationElement(quadPos);
 
-    for (size_t i = 0; i < elementMatrix_A.N(); i++) {
+      for (size_t i = 0; i < n; i++)
+        jacobian.mv(ref.referenceGradients[pt][i][0], gradients[i]);
 
+      for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j < n; j++)
+          elementMatrix_A[localView.tree().localIndex(i)][localView.tree().localIndex(j)]
+                  -= (gradients[i] * gradients[j]) * quad_A[pt].weight() * integrationElement;
+    }
 
-      auto row = localIndexSet.index(i);
+    const auto &quad_M = *ref.quad_M;
+    for (size_t pt = 0; pt < quad_M.size(); pt++) {
+      const auto integrationElement = geometry.integrationElement(quad_M[pt].position());
+      const auto &shapeFunctionValues = ref.shapeFunctionValues[pt];
 
-      for (size_t j = 0; j < elementMatrix_A.M(); j++) {
+      for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j < n; j++)
+          elementMatrix_M[localView.tree().localIndex(i)][localView.tree().localIndex(j)]
+                  += (shapeFunctionValues[i] * shapeFunctionValues[j]) * quad_M[pt].weight() * integrationElement;
+    }
+
+    if (affine) {
+      affineA = elementMatrix_A;
+      affineM = elementMatrix_M;
+      affineValid = true;
+    }
+  }
+};
 
 
-        auto col = localIndexSet.index(j);
 
+/**
+ * Assembles stiffness matrix @p A and mass matrix @p M.
+ *
+ * The element loop runs on `assembly_threads` threads (runtime parameter, default 1), see
+ * `ColoredAssembler`.
+ */
+template<class Basis>
+void assembleProblem(const Basis &basis,
+                            Dune::BCRSMatrix <Dune::FieldMatrix<double, 1, 1>> &A,
+                            Dune::BCRSMatrix <Dune::FieldMatrix<double, 1, 1>> &M){
+                            //Dune::DenseMatrix<Dune::FieldMatrix<double,1,1>> M_inverse) {
 
-        A[row][col] += elementMatrix_A[i][j];
-        M[row][col] += elementMatrix_M[i][j];
+  using BasisType = typename std::decay<decltype(*basis)>::type;
+  const size_t num_threads = pfasst::config::get_value<size_t>("assembly_threads", 1);
 
+  ColoredAssembler<BasisType> assembler(basis, num_threads);
 
-      }
-    }
+  assembler.exportPattern(A);
+  assembler.exportPattern(M);
 
+  A = 0;
+  M = 0;
+
+  assembler.assemble(std::vector<Dune::BCRSMatrix<Dune::FieldMatrix<double, 1, 1>>*>{&A, &M},
+                     StiffnessMassKernel<BasisType::GridView::dimension>());
 
-  }
   //M_invers=M;
 
   //auto isDirichlet = [] (auto x) {return (x[0]<1e-8 or x[0]>0.9999 or x[1]<1e-8 or x[1]>0.9999);}; //ruth_dim
@@ -1,10 +1,17 @@
 
 //#include <dune/grid/yaspgrid.hh>
 //#include "assemble.hpp"
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <dune/fufem/assemblers/transferoperatorassembler.hh>
 
 
 #include <dune/common/function.hh>
+#include <dune/common/timer.hh>
 #include <dune/common/bitsetvector.hh>
 #include <dune/common/indices.hh>
 #include <dune/geometry/quadraturerules.hh>
@@ -29,6 +36,10 @@
 #include <dune/functions/gridfunctions/discreteglobalbasisfunction.hh>
 #include <dune/functions/gridfunctions/gridviewfunction.hh>
 
+#include <pfasst/config.hpp>
+
+#include "matrix_cache.hpp"
+
 
 
 
@@ -70,6 +81,8 @@ typedef Dune::BlockVector<Dune::FieldVector<double,1> > VectorType;
 
 	  //std::shared_ptr<TransferOperatorAssembler<Dune::YaspGrid<1>>> transfer;
 	  std::shared_ptr<std::vector<MatrixType*>> transferMatrix;
+	  //! wall clock seconds per startup phase, in the order the phases ran
+	  std::vector<std::pair<std::string, double>> startup_times;
 	  //MatrixType m1;
 	  //std::vector<MatrixType> m;
 		    
@@ -91,6 +104,9 @@ typedef Dune::BlockVector<Dune::FieldVector<double,1> > VectorType;
 	    n_elem=nelements;
 	    n_dof = new size_t [n_levels];
 
+	    Dune::Timer timer;
+	    double time_grid = 0, time_basis = 0;
+
 	
 	    const int DIMENSION=1;
 	    //if(DIMENSION==2){
@@ -119,6 +135,7 @@ typedef Dune::BlockVector<Dune::FieldVector<double,1> > VectorType;
 #else
             this->grid = std::make_shared<GridType>(hL, hR, n);
 #endif
+	    time_grid += timer.elapsed();
             //grid->globalRefine(8);
             
             
@@ -134,7 +151,10 @@ typedef Dune::BlockVector<Dune::FieldVector<double,1> > VectorType;
 	    
 	    for (int i=0; i<n_levels; i++){
 	      
+	      timer.reset();
 	      grid->globalRefine((bool) i);
+	      time_grid += timer.elapsed();
+	      timer.reset();
 	      //GridType::LeafGridView gridView = grid->leafGridView();
 	      //BasisFunction* b = new BasisFunction(gridView);
 	      //std::cout << "***** groesse" << b->size() << std::endl;
@@ -149,8 +169,11 @@ typedef Dune::BlockVector<Dune::FieldVector<double,1> > VectorType;
 	      auto view = grid->levelGridView(i);
               fe_basis[n_levels-i-1] = std::make_shared<BasisFunction>(grid->levelGridView(i)); //grid->levelGridView(i));//gridView);
 	      n_dof[n_levels-i-1]    = fe_basis[n_levels-i-1]->size();
+	      time_basis += timer.elapsed();
 
 	    } 
+	    this->add_startup_time("grid", time_grid);
+	    this->add_startup_time("basis", time_basis);
 	    //std::shared_ptr<BasisFunction> ruth = (*basis)[0];
 	    //ruth->size();
 	    //(*basis)[0]->gridView();
@@ -161,7 +184,9 @@ typedef Dune::BlockVector<Dune::FieldVector<double,1> > VectorType;
 
 	     //std::cout << "***** Anzahl der finiten Elemente " << nelements << std::endl;
 	    if(nlevels>1){ 
+	      timer.reset();
 	      this->create_transfer();
+	      this->add_startup_time("transfer", timer.elapsed());
 	      //m.resize(nlevels);
 	      
 	    }
@@ -186,25 +211,50 @@ typedef Dune::BlockVector<Dune::FieldVector<double,1> > VectorType;
 	  //MatrixType get_transfer(size_t l){	    std::cout <<  "transfer rueckgabe" <<  std::endl; return *transferMatrix->at(0);}
 	  std::shared_ptr<std::vector<MatrixType*>> get_transfer(){	   return transferMatrix;}
 	  size_t get_nlevel() {return n_levels;}
+
+	  //! adds @p seconds to @p phase, which is appended if not recorded yet
+	  void add_startup_time(const std::string& phase, const double seconds){
+	    for (auto& recorded : startup_times) {
+	      if (recorded.first == phase) {
+	        recorded.second += seconds;
+	        return;
+	      }
+	    }
+	    startup_times.emplace_back(phase, seconds);
+	  }
+
+	  //! logs the wall clock time of every startup phase recorded so far
+	  void report_startup() const {
+	    double total = 0;
+	    ML_CLOG(INFO, "USER", "startup times:");
+	    for (const auto& phase : startup_times) {
+	      ML_CLOG(INFO, "USER", "  " << std::left << std::setw(14) << phase.first << phase.second << " s");
+	      total += phase.second;
+	    }
+	    ML_CLOG(INFO, "USER", "  " << std::left << std::setw(14) << "total" << total << " s");
+	  }
 	  
+	  //! assembles the transfer matrices between the grid levels, or loads them from the matrix cache
 	  void create_transfer(){
-	    transfer = std::make_shared<TransferOperatorAssembler<GridType>>(*grid);
 	    transferMatrix = std::make_shared<std::vector<MatrixType*>>();
 	    for (int i=0; i< n_levels-1; i++){
 	      transferMatrix->push_back(new MatrixType()); // hier nur referenz die evtl geloescht wird??
 	    }
-	    transfer->assembleMatrixHierarchy<MatrixType>(*transferMatrix);
-	    
-	    std::shared_ptr<std::vector<MatrixType*>> vecvec = transferMatrix;
-	    //std::cout <<  "transfer erzeugt groesse " << (*vecvec->at(0)).M() <<  std::endl;
-	    for (int i=0; i< vecvec->at(0)->N(); i++){
-	      for (int j=0; j< (*vecvec->at(0)).M(); j++){
-		if(vecvec->at(0)->exists(i,j)){
-		  //std::cout << ((*vecvec->at(0))[i][j]) << std::endl;
-		}
-	      }
 
-        }
+	    const MatrixCache cache(pfasst::config::get_value<std::string>("matrix_cache", ""));
+	    std::ostringstream key;
+	    // bump the version whenever the assembled transfer operators change
+	    key << "FE_Newton transfer version=1 levels=" << n_levels;
+	    for (int i=0; i< n_levels; i++){
+	      key << " | " << describe_grid_view(grid->levelGridView(i));
+	    }
+	    if (cache.load(key.str(), *transferMatrix)) {
+	      return;
+	    }
+
+	    transfer = std::make_shared<TransferOperatorAssembler<GridType>>(*grid);
+	    transfer->assembleMatrixHierarchy<MatrixType>(*transferMatrix);
+	    cache.store(key.str(), std::vector<const MatrixType*>(transferMatrix->begin(), transferMatrix->end()));
 	  }
 	  
 	  
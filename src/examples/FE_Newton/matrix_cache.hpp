@@ -0,0 +1,267 @@
+#ifndef _PFASST__EXAMPLES__FE_NEWTON__MATRIX_CACHE_HPP_
+#define _PFASST__EXAMPLES__FE_NEWTON__MATRIX_CACHE_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <pfasst/logging.hpp>
+
+
+/**
+ * Binary on-disk cache of assembled scalar `BCRSMatrix`es.
+ *
+ * A cache file holds a set of matrices in CSR form, i.e. per matrix row pointers, column indices and
+ * values, behind a header with the key the set was stored under.
+ * The key describes everything the matrices depend on, e.g. grid parameters, basis order and the
+ * revision of the assembling code, so files of an older assembly are never picked up; its FNV-1a
+ * hash names the file, and the key itself is compared on loading.
+ *
+ * Files are mapped read-only on loading, thus all ranks of a run share the page cache instead of
+ * each reading its own copy.
+ * Storing writes a temporary file which is then renamed, so ranks storing the same set concurrently
+ * never expose a partially written file.
+ *
+ * Caching is disabled with an empty directory; the examples take the directory from the runtime
+ * parameter `matrix_cache`.
+ */
+class MatrixCache {
+
+  //! first bytes of every cache file, the last one being the format version
+  static const char* magic() { return "PFMCACH1"; }
+
+  std::string directory;
+
+  struct Header {
+    char          magic[8];
+    std::uint64_t hash;
+    std::uint64_t key_length;
+    std::uint64_t num_matrices;
+  };
+
+  struct MatrixHeader {
+    std::uint64_t rows;
+    std::uint64_t cols;
+    std::uint64_t nonzeroes;
+  };
+
+public:
+  explicit MatrixCache(const std::string &directory) : directory(directory) {}
+
+  bool enabled() const { return !directory.empty(); }
+
+  static std::uint64_t hash(const std::string &key) {
+    std::uint64_t h = 14695981039346656037ULL;
+    for (const unsigned char c : key) {
+      h ^= c;
+      h *= 1099511628211ULL;
+    }
+    return h;
+  }
+
+  std::string path(const std::string &key) const {
+    std::ostringstream os;
+    os << directory << "/pfasst_matrices_" << std::hex << std::setw(16) << std::setfill('0') << hash(key) << ".bin";
+    return os.str();
+  }
+
+  /**
+   * Fills @p matrices from the cache file of @p key.
+   *
+   * The matrices must be freshly constructed, as they are built row-wise from the file.
+   *
+   * @returns `false` if caching is disabled, there is no file for @p key or it does not match the
+   *   number of @p matrices; the matrices are left untouched then
+   */
+  template<class MatrixT>
+  bool load(const std::string &key, const std::vector<MatrixT*> &matrices) const {
+    if (!enabled())
+      return false;
+
+    const std::string file = path(key);
+    const int fd = ::open(file.c_str(), O_RDONLY);
+    if (fd < 0)
+      return false;
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || size_t(info.st_size) < sizeof(Header)) {
+      ::close(fd);
+      return false;
+    }
+    const size_t size = info.st_size;
+    void *mapped = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED)
+      return false;
+
+    const bool valid = read(static_cast<const char*>(mapped), size, key, matrices);
+    ::munmap(mapped, size);
+
+    if (!valid)
+      ML_CLOG(WARNING, "USER", "ignoring stale or broken matrix cache " << file);
+    return valid;
+  }
+
+  //! Writes @p matrices to the cache file of @p key; failures only cost the next run a reassembly.
+  template<class MatrixT>
+  void store(const std::string &key, const std::vector<const MatrixT*> &matrices) const {
+    if (!enabled())
+      return;
+
+    const std::string file = path(key);
+    const std::string tmp = file + ".tmp" + std::to_string(::getpid());
+    std::ofstream out(tmp, std::ios::binary);
+
+    Header header;
+    std::memcpy(header.magic, magic(), sizeof(header.magic));
+    header.hash = hash(key);
+    header.key_length = key.size();
+    header.num_matrices = matrices.size();
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(key.data(), key.size());
+
+    for (const MatrixT *matrix : matrices) {
+      const MatrixHeader sizes = {matrix->N(), matrix->M(), matrix->nonzeroes()};
+      out.write(reinterpret_cast<const char*>(&sizes), sizeof(sizes));
+
+      std::vector<std::uint64_t> row_ptr(1, 0), col;
+      std::vector<double> values;
+      col.reserve(sizes.nonzeroes);
+      values.reserve(sizes.nonzeroes);
+      for (auto row = matrix->begin(); row != matrix->end(); ++row) {
+        for (auto entry = row->begin(); entry != row->end(); ++entry) {
+          col.push_back(entry.index());
+          values.push_back((*entry)[0][0]);
+        }
+        row_ptr.push_back(col.size());
+      }
+      out.write(reinterpret_cast<const char*>(row_ptr.data()), row_ptr.size() * sizeof(std::uint64_t));
+      out.write(reinterpret_cast<const char*>(col.data()), col.size() * sizeof(std::uint64_t));
+      out.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+    }
+
+    out.close();
+    if (!out || std::rename(tmp.c_str(), file.c_str()) != 0) {
+      std::remove(tmp.c_str());
+      ML_CLOG(WARNING, "USER", "could not write matrix cache " << file);
+    }
+  }
+
+private:
+  template<class MatrixT>
+  static bool read(const char *data, const size_t size, const std::string &key,
+                   const std::vector<MatrixT*> &matrices) {
+    Header header;
+    std::memcpy(&header, data, sizeof(header));
+    size_t offset = sizeof(header);
+    if (std::memcmp(header.magic, magic(), sizeof(header.magic)) != 0 || header.hash != hash(key)
+        || header.key_length != key.size() || header.num_matrices != matrices.size()
+        || size - offset < key.size() || key.compare(0, key.size(), data + offset, key.size()) != 0)
+      return false;
+    offset += key.size();
+
+    // parse and check everything before touching any matrix
+    struct CSR {
+      MatrixHeader sizes;
+      std::vector<std::uint64_t> row_ptr, col;
+      std::vector<double> values;
+    };
+    std::vector<CSR> csr(matrices.size());
+    for (auto &c : csr) {
+      if (size - offset < sizeof(MatrixHeader))
+        return false;
+      std::memcpy(&c.sizes, data + offset, sizeof(MatrixHeader));
+      offset += sizeof(MatrixHeader);
+
+      const auto &s = c.sizes;
+      if (s.rows >= std::numeric_limits<size_t>::max() / 8 || s.nonzeroes >= std::numeric_limits<size_t>::max() / 16
+          || size - offset < (s.rows + 1) * sizeof(std::uint64_t) + s.nonzeroes * (sizeof(std::uint64_t) + sizeof(double)))
+        return false;
+
+      c.row_ptr.resize(s.rows + 1);
+      c.col.resize(s.nonzeroes);
+      c.values.resize(s.nonzeroes);
+      std::memcpy(c.row_ptr.data(), data + offset, c.row_ptr.size() * sizeof(std::uint64_t));
+      offset += c.row_ptr.size() * sizeof(std::uint64_t);
+      std::memcpy(c.col.data(), data + offset, c.col.size() * sizeof(std::uint64_t));
+      offset += c.col.size() * sizeof(std::uint64_t);
+      std::memcpy(c.values.data(), data + offset, c.values.size() * sizeof(double));
+      offset += c.values.size() * sizeof(double);
+
+      if (c.row_ptr.front() != 0 || c.row_ptr.back() != s.nonzeroes)
+        return false;
+      for (size_t i = 0; i < s.rows; i++) {
+        if (c.row_ptr[i] > c.row_ptr[i + 1])
+          return false;
+        for (auto k = c.row_ptr[i]; k < c.row_ptr[i + 1]; k++)
+          if (c.col[k] >= s.cols || (k > c.row_ptr[i] && c.col[k] <= c.col[k - 1]))
+            return false;
+      }
+    }
+
+    for (size_t m = 0; m < matrices.size(); m++) {
+      const auto &c = csr[m];
+      MatrixT &matrix = *matrices[m];
+      matrix.setBuildMode(MatrixT::row_wise);
+      matrix.setSize(c.sizes.rows, c.sizes.cols, c.sizes.nonzeroes);
+      size_t i = 0;
+      for (auto row = matrix.createbegin(); row != matrix.createend(); ++row, ++i)
+        for (auto k = c.row_ptr[i]; k < c.row_ptr[i + 1]; k++)
+          row.insert(c.col[k]);
+
+      size_t k = 0;
+      for (auto row = matrix.begin(); row != matrix.end(); ++row)
+        for (auto entry = row->begin(); entry != row->end(); ++entry, ++k)
+          *entry = c.values[k];
+    }
+    return true;
+  }
+};
+
+
+//! Cache key part describing a grid view by its number of elements and bounding box.
+template<class GridView>
+std::string describe_grid_view(const GridView &gridView) {
+  constexpr int dim = GridView::dimension;
+  std::vector<double> lower(dim, std::numeric_limits<double>::max());
+  std::vector<double> upper(dim, std::numeric_limits<double>::lowest());
+  for (const auto &vertex : vertices(gridView)) {
+    const auto x = vertex.geometry().corner(0);
+    for (int d = 0; d < dim; d++) {
+      lower[d] = std::min(lower[d], double(x[d]));
+      upper[d] = std::max(upper[d], double(x[d]));
+    }
+  }
+
+  std::ostringstream os;
+  os << std::setprecision(17) << "dim=" << dim << " elements=" << gridView.size(0) << " vertices=" << gridView.size(dim);
+  for (int d = 0; d < dim; d++)
+    os << " [" << lower[d] << "," << upper[d] << "]";
+  return os.str();
+}
+
+//! Cache key part describing a scalar Lagrange basis by its grid view, order and size.
+template<class Basis>
+std::string describe_basis(const Basis &basis) {
+  auto localView = basis.localView();
+  localView.bind(*basis.gridView().template begin<0>());
+
+  std::ostringstream os;
+  os << describe_grid_view(basis.gridView()) << " order=" << localView.tree().finiteElement().localBasis().order()
+     << " size=" << basis.size();
+  return os.str();
+}
+
+#endif  // _PFASST__EXAMPLES__FE_NEWTON__MATRIX_CACHE_HPP_
@@ -0,0 +1,299 @@
+#ifndef _PFASST__EXAMPLES__FE_NEWTON__SHARED_OPERATORS_HPP_
+#define _PFASST__EXAMPLES__FE_NEWTON__SHARED_OPERATORS_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#if HAVE_MPI
+#include <mpi.h>
+#endif
+
+#include <pfasst/logging.hpp>
+
+
+/**
+ * Memory segment shared read-only by all ranks of a node.
+ *
+ * The segment is an MPI shared memory window allocated by the first rank of the node, which fills
+ * it; all other ranks map the very same memory.
+ * Without MPI, or before `MPI_Init()`, the segment is private memory of the process.
+ *
+ * Creating and destroying segments is collective over the ranks of a node, thus all ranks have to
+ * create and release them in the same order.
+ */
+class SharedSegment {
+
+  char   *_data = nullptr;
+  size_t  _bytes = 0;
+  std::vector<std::uint64_t> _private;
+#if HAVE_MPI
+  MPI_Win _window = MPI_WIN_NULL;
+#endif
+
+public:
+#if HAVE_MPI
+  //! communicator of the ranks on this node, split off `MPI_COMM_WORLD` once
+  static MPI_Comm node_comm() {
+    static MPI_Comm comm = MPI_COMM_NULL;
+    if (comm == MPI_COMM_NULL) {
+      MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &comm);
+    }
+    return comm;
+  }
+
+  static bool mpi_active() {
+    int initialized = 0, finalized = 0;
+    MPI_Initialized(&initialized);
+    MPI_Finalized(&finalized);
+    return initialized && !finalized;
+  }
+#endif
+
+  //! whether this rank fills the segments of its node
+  static bool is_leader() {
+#if HAVE_MPI
+    if (mpi_active()) {
+      int rank = 0;
+      MPI_Comm_rank(node_comm(), &rank);
+      return rank == 0;
+    }
+#endif
+    return true;
+  }
+
+  //! broadcasts @p values of the node leader to all ranks of the node
+  static void broadcast(std::uint64_t *values, const int count) {
+#if HAVE_MPI
+    if (mpi_active()) {
+      MPI_Bcast(values, count, MPI_UINT64_T, 0, node_comm());
+    }
+#else
+    (void) values;
+    (void) count;
+#endif
+  }
+
+  //! @param[in] bytes  size of the segment, only significant on the node leader
+  explicit SharedSegment(const size_t bytes) {
+    std::uint64_t size = bytes;
+    broadcast(&size, 1);
+    _bytes = size;
+
+#if HAVE_MPI
+    if (mpi_active()) {
+      const MPI_Aint local = is_leader() ? MPI_Aint(_bytes) : 0;
+      void *base = nullptr;
+      MPI_Win_allocate_shared(local, 1, MPI_INFO_NULL, node_comm(), &base, &this->_window);
+
+      MPI_Aint size_leader = 0;
+      int disp_unit = 0;
+      MPI_Win_shared_query(this->_window, 0, &size_leader, &disp_unit, &base);
+      this->_data = static_cast<char*>(base);
+
+      // passive target epoch for the whole lifetime; publish() synchronizes the leader's writes
+      MPI_Win_lock_all(MPI_MODE_NOCHECK, this->_window);
+      return;
+    }
+#endif
+
+    this->_private.resize((_bytes + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+    this->_data = reinterpret_cast<char*>(this->_private.data());
+  }
+
+  SharedSegment(const SharedSegment&) = delete;
+  SharedSegment& operator=(const SharedSegment&) = delete;
+
+  ~SharedSegment() {
+#if HAVE_MPI
+    if (this->_window != MPI_WIN_NULL && mpi_active()) {
+      MPI_Win_unlock_all(this->_window);
+      MPI_Win_free(&this->_window);
+    }
+#endif
+  }
+
+  //! writable storage; only to be written by the node leader before publish()
+  char* data() { return this->_data; }
+  const char* data() const { return this->_data; }
+  size_t size() const { return this->_bytes; }
+
+  //! makes the leader's writes visible to all ranks of the node
+  void publish() {
+#if HAVE_MPI
+    if (this->_window != MPI_WIN_NULL) {
+      MPI_Win_sync(this->_window);
+      MPI_Barrier(node_comm());
+      MPI_Win_sync(this->_window);
+    }
+#endif
+  }
+};
+
+
+/**
+ * Read-only scalar CSR matrix in a SharedSegment.
+ *
+ * Offers the products of `BCRSMatrix` used by the sweepers, plus conversions for places that need a
+ * `BCRSMatrix`, e.g. Newton Jacobians which are modified per rank anyway.
+ */
+class SharedMatrix {
+
+  std::shared_ptr<SharedSegment> _segment;
+  size_t _rows = 0, _cols = 0, _nonzeroes = 0;
+  const std::uint64_t *_row_ptr = nullptr;
+  const std::uint64_t *_col = nullptr;
+  const double *_values = nullptr;
+
+  template<class X, class Y>
+  void multiply(const double alpha, const X &x, Y &y) const {
+    for (size_t i = 0; i < this->_rows; i++) {
+      double sum = 0;
+      for (auto k = this->_row_ptr[i]; k < this->_row_ptr[i + 1]; k++) {
+        sum += this->_values[k] * x[this->_col[k]][0];
+      }
+      y[i][0] += alpha * sum;
+    }
+  }
+
+public:
+  /**
+   * Copies @p matrix into a new segment shared by the ranks of this node.
+   *
+   * Collective over the node; @p matrix is only read on the node leader and may be `nullptr` elsewhere.
+   */
+  template<class MatrixT>
+  static SharedMatrix share(const MatrixT *matrix) {
+    std::uint64_t sizes[3] = {0, 0, 0};
+    if (SharedSegment::is_leader()) {
+      sizes[0] = matrix->N();
+      sizes[1] = matrix->M();
+      sizes[2] = matrix->nonzeroes();
+    }
+    SharedSegment::broadcast(sizes, 3);
+
+    SharedMatrix shared;
+    shared._rows = sizes[0];
+    shared._cols = sizes[1];
+    shared._nonzeroes = sizes[2];
+    shared._segment = std::make_shared<SharedSegment>(
+      (shared._rows + 1 + shared._nonzeroes) * sizeof(std::uint64_t) + shared._nonzeroes * sizeof(double));
+
+    char *data = shared._segment->data();
+    auto *row_ptr = reinterpret_cast<std::uint64_t*>(data);
+    auto *col = row_ptr + shared._rows + 1;
+    auto *values = reinterpret_cast<double*>(col + shared._nonzeroes);
+
+    if (SharedSegment::is_leader()) {
+      size_t k = 0;
+      row_ptr[0] = 0;
+      for (auto row = matrix->begin(); row != matrix->end(); ++row) {
+        for (auto entry = row->begin(); entry != row->end(); ++entry, ++k) {
+          col[k] = entry.index();
+          values[k] = (*entry)[0][0];
+        }
+        row_ptr[row.index() + 1] = k;
+      }
+    }
+    shared._segment->publish();
+
+    shared._row_ptr = row_ptr;
+    shared._col = col;
+    shared._values = values;
+    return shared;
+  }
+
+  size_t N() const { return this->_rows; }
+  size_t M() const { return this->_cols; }
+  size_t nonzeroes() const { return this->_nonzeroes; }
+
+  //! @f$ y = A x @f$
+  template<class X, class Y>
+  void mv(const X &x, Y &y) const {
+    y = 0.0;
+    this->multiply(1.0, x, y);
+  }
+  //! @f$ y \mathrel{+}= A x @f$
+  template<class X, class Y>
+  void umv(const X &x, Y &y) const { this->multiply(1.0, x, y); }
+  //! @f$ y \mathrel{-}= A x @f$
+  template<class X, class Y>
+  void mmv(const X &x, Y &y) const { this->multiply(-1.0, x, y); }
+  //! @f$ y \mathrel{+}= \alpha A x @f$
+  template<class X, class Y>
+  void usmv(const double alpha, const X &x, Y &y) const { this->multiply(alpha, x, y); }
+
+  //! Builds @p matrix, which must be freshly constructed, as a private copy.
+  template<class MatrixT>
+  void copy_to(MatrixT &matrix) const {
+    matrix.setBuildMode(MatrixT::row_wise);
+    matrix.setSize(this->_rows, this->_cols, this->_nonzeroes);
+    size_t i = 0;
+    for (auto row = matrix.createbegin(); row != matrix.createend(); ++row, ++i) {
+      for (auto k = this->_row_ptr[i]; k < this->_row_ptr[i + 1]; k++) {
+        row.insert(this->_col[k]);
+      }
+    }
+    matrix = 0.0;
+    this->add_to(matrix, 1.0);
+  }
+
+  /**
+   * @f$ B \mathrel{+}= \alpha A @f$ for a matrix @p matrix with the sparsity pattern of this one.
+   */
+  template<class MatrixT>
+  void add_to(MatrixT &matrix, const double alpha) const {
+    if (matrix.N() != this->_rows || matrix.nonzeroes() != this->_nonzeroes) {
+      ML_CLOG(ERROR, "USER", "SharedMatrix::add_to needs a matrix with the same sparsity pattern");
+      throw std::runtime_error("sparsity pattern mismatch");
+    }
+    size_t k = 0;
+    for (auto row = matrix.begin(); row != matrix.end(); ++row) {
+      for (auto entry = row->begin(); entry != row->end(); ++entry, ++k) {
+        (*entry)[0][0] += alpha * this->_values[k];
+      }
+    }
+  }
+};
+
+
+/**
+ * Read-only vector in a SharedSegment.
+ */
+class SharedVector {
+
+  std::shared_ptr<SharedSegment> _segment;
+  size_t _size = 0;
+  const double *_values = nullptr;
+
+public:
+  //! Collective over the node like SharedMatrix::share(); @p vector is only read on the node leader.
+  template<class VectorT>
+  static SharedVector share(const VectorT *vector) {
+    std::uint64_t size = SharedSegment::is_leader() ? vector->size() : 0;
+    SharedSegment::broadcast(&size, 1);
+
+    SharedVector shared;
+    shared._size = size;
+    shared._segment = std::make_shared<SharedSegment>(shared._size * sizeof(double));
+
+    auto *values = reinterpret_cast<double*>(shared._segment->data());
+    if (SharedSegment::is_leader()) {
+      for (size_t i = 0; i < shared._size; i++) {
+        values[i] = (*vector)[i][0];
+      }
+    }
+    shared._segment->publish();
+
+    shared._values = values;
+    return shared;
+  }
+
+  size_t size() const { return this->_size; }
+  const double* data() const { return this->_values; }
+  double operator[](const size_t i) const { return this->_values[i]; }
+};
+
+#endif  // _PFASST__EXAMPLES__FE_NEWTON__SHARED_OPERATORS_HPP_
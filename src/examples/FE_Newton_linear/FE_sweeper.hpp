@@ -108,9 +108,11 @@ namespace pfasst
           evaluate_rhs_expl(const typename SweeperTrait::time_t& t,
                             const shared_ptr<typename SweeperTrait::encap_t> u) override;*/
 
-          virtual shared_ptr<typename SweeperTrait::encap_t>
+          using IMEX<SweeperTrait, Enabled>::evaluate_rhs_impl;
+          virtual void
           evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
-                            const shared_ptr<typename SweeperTrait::encap_t> u) override;
+                            const shared_ptr<typename SweeperTrait::encap_t> u,
+                            shared_ptr<typename SweeperTrait::encap_t> result) override;
 
           virtual void implicit_solve(shared_ptr<typename SweeperTrait::encap_t> f,
                                       shared_ptr<typename SweeperTrait::encap_t> u,
@@ -236,10 +236,12 @@ namespace pfasst
         //ML_CLOG(INFO, this->get_logger_id(), "  expl:        " << this->_num_expl_f_evals);
         ML_CLOG(INFO, this->get_logger_id(), "  impl:        " << this->_num_impl_f_evals);
         ML_CLOG(INFO, this->get_logger_id(), "  impl solves: " << this->_num_impl_solves);
+        ML_CLOG(INFO, this->get_logger_id(), "  skipped:     " << this->_num_skipped_evaluations);
 
         //this->_num_expl_f_evals = 0;
         this->_num_impl_f_evals = 0;
         this->_num_impl_solves = 0;
+        this->_num_skipped_evaluations = 0;
       }
 
       template<class SweeperTrait, typename Enabled>
@@ -381,20 +383,19 @@ namespace pfasst
       }*/
 
       template<class SweeperTrait, typename Enabled>
-      shared_ptr<typename SweeperTrait::encap_t>
+      void
       Heat_FE<SweeperTrait, Enabled>::evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
-                                                       const shared_ptr<typename SweeperTrait::encap_t> u)
+                                                       const shared_ptr<typename SweeperTrait::encap_t> u,
+                                                       shared_ptr<typename SweeperTrait::encap_t> result)
       {
 	
          ML_CVLOG(4, this->get_logger_id(),  "evaluating IMPLICIT part at t=" << t);
 
 
 
-        auto result = this->get_encap_factory().create();
-        auto u2 = this->get_encap_factory().create();
+        auto u2 = this->get_encap_factory().create_uninitialized();
         double nu =this->_nu;
 
-	u2->zero();
 	for (int i=0; i<u->get_data().size(); ++i)
 	    {
 	    u2->data()[i]= -pow(u->get_data()[i], _n+1);	
@@ -414,7 +415,6 @@ namespace pfasst
 
          }*/
         
-        return result;
       }
 
       template<class SweeperTrait, typename Enabled>
@@ -590,12 +590,14 @@ namespace pfasst
           
           
           
-          for (int i=0; i<df.N(); ++i)
+          // df and M share their sparsity pattern, thus both are walked entry by entry
+          auto row_M = this->M_dune.begin();
+          for (auto row = df.begin(); row != df.end(); ++row, ++row_M)
             {
-            for (int j=0; j<df.M(); ++j)
+            auto col_M = row_M->begin();
+            for (auto col = row->begin(); col != row->end(); ++col, ++col_M)
                 {
-                    if (df.exists(i,j)) 
-                        df[i][j]= (_nu*_nu)*(_n+1) *this->M_dune[i][j] * pow(u->get_data()[j], _n);	
+                    *col = (_nu*_nu)*(_n+1) * (*col_M) * pow(u->get_data()[col.index()], _n);
                 }
             }
             df.axpy((-_nu*_nu), this->M_dune);
@@ -97,14 +97,28 @@ namespace pfasst
           using BasisFunction = Dune::Functions::PQkNodalBasis<GridView,1>; //SweeperTrait::BASE_ORDER>;
           std::shared_ptr<BasisFunction> basis;
 
+          /**
+           * TNNMG solver of the implicit systems.
+           *
+           * Built once in `setup()`; each implicit solve only replaces the operator, the right hand side
+           * and the iterate it works on.
+           * Its state is shared by all nodes, so implicit solves hold its mutex while they use it.
+           */
+          struct tnnmg_t;
+          std::shared_ptr<tnnmg_t>                       _tnnmg;
+
         protected:
-          virtual shared_ptr<typename SweeperTrait::encap_t>
+          using IMEX<SweeperTrait, Enabled>::evaluate_rhs_expl;
+          virtual void
           evaluate_rhs_expl(const typename SweeperTrait::time_t& t,
-                            const shared_ptr<typename SweeperTrait::encap_t> u) override;
+                            const shared_ptr<typename SweeperTrait::encap_t> u,
+                            shared_ptr<typename SweeperTrait::encap_t> result) override;
 
-          virtual shared_ptr<typename SweeperTrait::encap_t>
+          using IMEX<SweeperTrait, Enabled>::evaluate_rhs_impl;
+          virtual void
           evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
-                            const shared_ptr<typename SweeperTrait::encap_t> u) override;
+                            const shared_ptr<typename SweeperTrait::encap_t> u,
+                            shared_ptr<typename SweeperTrait::encap_t> result) override;
 
           virtual void implicit_solve(shared_ptr<typename SweeperTrait::encap_t> f,
                                       shared_ptr<typename SweeperTrait::encap_t> u,
@@ -130,6 +144,8 @@ namespace pfasst
           Heat_FE<SweeperTrait, Enabled>& operator=(Heat_FE<SweeperTrait, Enabled>&& other) = default;
 
           virtual void set_options() override;
+          //! Builds the TNNMG solver of the implicit systems.
+          virtual void setup() override;
 
           virtual shared_ptr<typename SweeperTrait::encap_t> exact(const typename SweeperTrait::time_t& t);
 	  virtual shared_ptr<typename SweeperTrait::encap_t> source(const typename SweeperTrait::time_t& t);
@@ -8,6 +8,7 @@
 #include <complex>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 using std::shared_ptr;
@@ -117,6 +118,127 @@ namespace pfasst
 
       }
 
+      template<class SweeperTrait, typename Enabled>
+      struct Heat_FE<SweeperTrait, Enabled>::tnnmg_t
+      {
+        using BitVector = Dune::Solvers::DefaultBitVector_t<VectorType>;
+        using TransferOperator = CompressedMultigridTransfer<VectorType>;
+        using TransferOperators = std::vector<std::shared_ptr<TransferOperator>>;
+        using Functional = Dune::TNNMG::BoxConstrainedQuadraticFunctional<MatrixType&, VectorType&, VectorType&, VectorType&, double>;
+        using LocalSolver = decltype(gaussSeidelLocalSolver(Dune::TNNMG::ScalarObstacleSolver()));
+        using NonlinearSmoother = Dune::TNNMG::NonlinearGSStep<Functional, LocalSolver, BitVector>;
+        using Linearization = Dune::TNNMG::BoxConstrainedQuadraticFunctionalConstrainedLinearization<Functional, BitVector>;
+        using DefectProjection = Dune::TNNMG::ObstacleDefectProjection;
+        using LineSearchSolver = TrivialSolver;
+        using MultiGrid = Dune::Solvers::MultigridStep<MatrixType, VectorType, BitVector>;
+        using Smoother = decltype(Dune::Solvers::BlockGSStepFactory<MatrixType, VectorType, BitVector>::create(Dune::Solvers::BlockGS::LocalSolvers::gs()));
+        using BaseSolver = Dune::Solvers::UMFPackSolver<MatrixType, VectorType>;
+        using Step = Dune::TNNMG::TNNMGStep<Functional, BitVector, Linearization, DefectProjection, LineSearchSolver>;
+        using Norm = EnergyNorm<MatrixType, VectorType>;
+        using Solver = LoopSolver<VectorType>;
+
+        // the functional, the norm and the iteration steps refer to these; implicit_solve() overwrites them
+        MatrixType                           matrix;
+        VectorType                           rhs;
+        VectorType                           x;
+        VectorType                           lower;
+        VectorType                           upper;
+
+        std::vector<char>                    dirichlet_left;
+        std::vector<char>                    dirichlet_right;
+        BitVector                            ignore;
+
+        TransferOperators                    transfer;
+        Functional                           J;
+        shared_ptr<NonlinearSmoother>        nonlinear_smoother;
+        Smoother                             smoother;
+        BaseSolver                           base_solver;
+        shared_ptr<MultiGrid>                mg_step;
+        DefectProjection                     projection;
+        Step                                 step;
+        Norm                                 norm;
+        Solver                               solver;
+
+        std::vector<double>                  correction_norms;
+        double                               old_energy;
+
+        //! all nodes share this solver, thus concurrent implicit solves take turns
+        std::mutex                           mutex;
+
+        tnnmg_t(const MatrixType& pattern, const BasisFunction& basis, const GridType& grid)
+          :   matrix(pattern)
+            , rhs(pattern.N())
+            , x(pattern.N())
+            , lower(pattern.N())
+            , upper(pattern.N())
+            , ignore(pattern.N())
+            , transfer(grid.maxLevel())
+            , J(matrix, rhs, lower, upper)
+            , nonlinear_smoother(std::make_shared<NonlinearSmoother>(J, x, gaussSeidelLocalSolver(Dune::TNNMG::ScalarObstacleSolver())))
+            , smoother(Dune::Solvers::BlockGSStepFactory<MatrixType, VectorType, BitVector>::create(Dune::Solvers::BlockGS::LocalSolvers::gs()))
+            , base_solver()
+            , mg_step(std::make_shared<MultiGrid>())
+            , projection()
+            , step(J, x, nonlinear_smoother, mg_step, 1, projection, LineSearchSolver())
+            , norm(matrix)
+            , solver(&step, 1e9, 0, &norm, Solver::FULL)
+            , correction_norms()
+            , old_energy(0.0)
+        {
+          lower = -989999;
+          upper = 342434;
+
+          auto isLeftDirichlet = [] (auto x) {return (x[0] < -20.0 + 1e-8 ) ;};
+          auto isRightDirichlet = [] (auto x) {return (x[0] > 20.0 - 1e-8 ) ;};
+          interpolate(basis, this->dirichlet_left, isLeftDirichlet);
+          interpolate(basis, this->dirichlet_right, isRightDirichlet);
+          for (size_t i = 0; i < this->ignore.size(); ++i) {
+            this->ignore[i] = this->dirichlet_left[i] || this->dirichlet_right[i];
+          }
+
+          for (size_t i = 0; i < this->transfer.size(); ++i) {
+            this->transfer[i] = std::make_shared<TransferOperator>();
+            this->transfer[i]->setup(grid, i, i+1);
+          }
+
+          this->mg_step->setSmoother(&(this->smoother));
+          this->mg_step->setTransferOperators(this->transfer);
+          this->mg_step->setMGType(1,3,3);
+          this->mg_step->basesolver_ = &(this->base_solver);
+
+          this->step.setIgnore(this->ignore);
+
+          this->solver.addCriterion(
+            [this](){
+              return Dune::formatString("   % 12.5e", this->J(this->x));
+            },
+            "   energy      ");
+          this->solver.addCriterion(
+            [this](){
+              const double current_energy = this->J(this->x);
+              const double decrease = current_energy - this->old_energy;
+              this->old_energy = current_energy;
+              return Dune::formatString("   % 12.5e", decrease);
+            },
+            "   decrease    ");
+          this->solver.addCriterion(
+            [this](){
+              return Dune::formatString("   % 12.5e", this->step.lastDampingFactor());
+            },
+            "   damping     ");
+          this->solver.addCriterion(
+            [this](){
+              return Dune::formatString("   % 12d", this->step.linearization().truncated().count());
+            },
+            "   truncated   ");
+          this->solver.addCriterion(Dune::Solvers::correctionNormCriterion(this->step, this->norm, 1e-8,
+                                                                           this->correction_norms));
+        }
+
+        tnnmg_t(const tnnmg_t& other) = delete;
+        tnnmg_t& operator=(const tnnmg_t& other) = delete;
+      };
+
       template<class SweeperTrait, typename Enabled>
       void
       Heat_FE<SweeperTrait, Enabled>::set_options()
@@ -134,6 +256,15 @@ namespace pfasst
 
       }
 
+      template<class SweeperTrait, typename Enabled>
+      void
+      Heat_FE<SweeperTrait, Enabled>::setup()
+      {
+        IMEX<SweeperTrait, Enabled>::setup();
+
+        this->_tnnmg = std::make_shared<tnnmg_t>(this->A_dune, *basis, *(FinEl->get_grid()));
+      }
+
       template<class SweeperTrait, typename Enabled>
       shared_ptr<typename SweeperTrait::encap_t>
       Heat_FE<SweeperTrait, Enabled>::exact(const typename SweeperTrait::time_t& t)
@@ -246,10 +377,12 @@ namespace pfasst
         ML_CLOG(INFO, this->get_logger_id(), "  expl:        " << this->_num_expl_f_evals);
         ML_CLOG(INFO, this->get_logger_id(), "  impl:        " << this->_num_impl_f_evals);
         ML_CLOG(INFO, this->get_logger_id(), "  impl solves: " << this->_num_impl_solves);
+        ML_CLOG(INFO, this->get_logger_id(), "  skipped:     " << this->_num_skipped_evaluations);
 
         this->_num_expl_f_evals = 0;
         this->_num_impl_f_evals = 0;
         this->_num_impl_solves = 0;
+        this->_num_skipped_evaluations = 0;
       }
 
       template<class SweeperTrait, typename Enabled>
@@ -371,43 +504,38 @@ namespace pfasst
       }
 
       template<class SweeperTrait, typename Enabled>
-      shared_ptr<typename SweeperTrait::encap_t>
+      void
       Heat_FE<SweeperTrait, Enabled>::evaluate_rhs_expl(const typename SweeperTrait::time_t& t,
-                                                       const shared_ptr<typename SweeperTrait::encap_t> u)
+                                                       const shared_ptr<typename SweeperTrait::encap_t> u,
+                                                       shared_ptr<typename SweeperTrait::encap_t> result)
       {
         UNUSED(u);
         ML_CVLOG(4, this->get_logger_id(),  "evaluating EXPLICIT part at t=" << t);
 
-        auto result = this->get_encap_factory().create();
-	auto Mresult = this->get_encap_factory().create();
-        result->zero();
+        auto f = this->get_encap_factory().create_uninitialized();
 
-	for (int i=0; i<result->data().size(); ++i)
-	{result->data()[i]= 8*this->_nu*this->_nu*u->data()[i]*u->data()[i]*(1.00-u->data()[i])/(this->_delta*this->_delta); /*this->source(t)->data()[i]*/;
-	//std::cout << u->data()[i] << " "<< result->data()[i] <<" "<< this->_delta <<std::endl; 
+	for (int i=0; i<f->data().size(); ++i)
+	{f->data()[i]= 8*this->_nu*this->_nu*u->data()[i]*u->data()[i]*(1.00-u->data()[i])/(this->_delta*this->_delta); /*this->source(t)->data()[i]*/;
+	//std::cout << u->data()[i] << " "<< f->data()[i] <<" "<< this->_delta <<std::endl; 
 	}
 	
-	this->M_dune.mv(result->data(), Mresult->data());
+	this->M_dune.mv(f->data(), result->data());
 	
         this->_num_expl_f_evals++;
-	
-        return Mresult;
-	//return result;
       }
 
       template<class SweeperTrait, typename Enabled>
-      shared_ptr<typename SweeperTrait::encap_t>
+      void
       Heat_FE<SweeperTrait, Enabled>::evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
-                                                       const shared_ptr<typename SweeperTrait::encap_t> u)
+                                                       const shared_ptr<typename SweeperTrait::encap_t> u,
+                                                       shared_ptr<typename SweeperTrait::encap_t> result)
       {
 	
         ML_CVLOG(4, this->get_logger_id(),  "evaluating IMPLICIT part at t=" << t);
 
 
 
-        auto result = this->get_encap_factory().create();
-        auto rhs = this->get_encap_factory().create();
-        auto rhs2 = this->get_encap_factory().create();
+        result->zero();
         double nu =this->_nu;
 
 	
@@ -445,7 +573,6 @@ namespace pfasst
         }*/
 
 
-        return result;
       }
 
       template<class SweeperTrait, typename Enabled>
@@ -458,170 +585,41 @@ namespace pfasst
       {
 	
 
-        Dune::BlockVector<Dune::FieldVector<double,1> > M_rhs_dune ;
-        M_rhs_dune.resize(rhs->get_data().size());
-	
-	
-	M_rhs_dune = rhs->get_data(); 
-
-        //this->M_dune.mv(rhs->data(), M_rhs_dune); //multipliziert rhs mit matrix_m_dune
-
-	
-	
-	auto isLeftDirichlet = [] (auto x) {return (x[0] < -20.0 + 1e-8 ) ;};
-	auto isRightDirichlet = [] (auto x) {return (x[0] > 20.0 - 1e-8 ) ;};
- 
-	
-	
-	std::vector<double> dirichletLeftNodes;
-	interpolate(*basis, dirichletLeftNodes, isLeftDirichlet);  
-
-  	std::vector<double> dirichletRightNodes;
-  	interpolate(*basis, dirichletRightNodes, isRightDirichlet);
-	
-  for(int i=0; i<rhs->data().size(); ++i){
-  
-    if(dirichletLeftNodes[i])
-    M_rhs_dune[i] = 1;
-
-        if(dirichletRightNodes[i])
-          M_rhs_dune[i] = 0;
-
-
-    
-  }
-	
-	
-	
-        Dune::BCRSMatrix<Dune::FieldMatrix<double,1,1> > M_dtA_dune = 	Dune::BCRSMatrix<Dune::FieldMatrix<double,1,1> >(this->A_dune);
-        M_dtA_dune *= (dt * this->_nu);
-        M_dtA_dune += this->M_dune;
-
-	auto isDirichlet = [] (auto x) {return (x[0] < -20.0 + 1e-8 or x[0] > 20.0-1e-8) ;};
-        std::vector<char> dirichletNodes;
-        interpolate(*basis, dirichletNodes, isDirichlet);  //tu valjda interpoliramo kao na nrpdju
-
-        for (size_t i=0; i< M_dtA_dune.N(); i++){
-            if (dirichletNodes[i]){
-                auto cIt = M_dtA_dune[i].begin();
-                auto cEndIt = M_dtA_dune[i].end();
+        assert(this->_tnnmg != nullptr);
+        auto& tnnmg = *(this->_tnnmg);
+        std::lock_guard<std::mutex> lock(tnnmg.mutex);
+
+        // rebind the persistent solver to this system: M + dt*nu*A with Dirichlet rows, rhs and iterate
+        tnnmg.matrix = 0.0;
+        tnnmg.matrix += this->M_dune;
+        tnnmg.matrix.axpy(dt * this->_nu, this->A_dune);
+        for (size_t i=0; i< tnnmg.matrix.N(); i++){
+            if (tnnmg.dirichlet_left[i] || tnnmg.dirichlet_right[i]){
+                auto cIt = tnnmg.matrix[i].begin();
+                auto cEndIt = tnnmg.matrix[i].end();
                 for(; cIt!=cEndIt; ++cIt){
-                    *cIt = (i==cIt.index()) ? 1.0 : 0.0;// 0.0;
+                    *cIt = (i==cIt.index()) ? 1.0 : 0.0;
                 }
             }
         }
 
-        using BitVector = Dune::Solvers::DefaultBitVector_t<VectorType>;
-        BitVector ignore(u->data().size());
-        for(int i=0; i<rhs->data().size(); ++i){
-          if (dirichletNodes[i])
-            ignore[i]=true;
-        }
-
-        //// Transfer setup
-        ////
-        using TransferOperator = CompressedMultigridTransfer<VectorType>;
-        using TransferOperators = std::vector<std::shared_ptr<TransferOperator>>;
-
-        auto gridptr = FinEl->get_grid();
-        TransferOperators transfer(gridptr->maxLevel());
-        for (size_t i = 0; i < transfer.size(); ++i)
-        {
-          // create transfer operator from level i to i+1
-          transfer[i] = std::make_shared<TransferOperator>();
-          transfer[i]->setup(*gridptr, i, i+1);
+        tnnmg.rhs = rhs->get_data();
+        for(size_t i=0; i<tnnmg.rhs.size(); ++i){
+          if(tnnmg.dirichlet_left[i])
+            tnnmg.rhs[i] = 1;
+          if(tnnmg.dirichlet_right[i])
+            tnnmg.rhs[i] = 0;
         }
 
-        auto& uu = u->data();
-        std::cout << "u0 =" << uu[0] << " u[end]=" << uu[uu.size()-1] << std::endl;
-       
-
-        //// TNNMG without actual constraints
-        VectorType lower(u->data().size());
-        lower = -989999;
-        VectorType upper(u->data().size());
-        upper = 342434;
-        using Functional = Dune::TNNMG::BoxConstrainedQuadraticFunctional<MatrixType&, VectorType&, VectorType&, VectorType&, double>;
-
-        auto J = Functional(M_dtA_dune, M_rhs_dune, lower, upper);
-
-        auto localSolver = gaussSeidelLocalSolver(Dune::TNNMG::ScalarObstacleSolver());
-        //auto localSolver = gaussSeidelLocalSolver(TrivialSolver());
-
-        using NonlinearSmoother = Dune::TNNMG::NonlinearGSStep<Functional, decltype(localSolver), BitVector>;
-        auto nonlinearSmoother = std::make_shared<NonlinearSmoother>(J, u->data(), localSolver);
-
-
-        using Linearization = Dune::TNNMG::BoxConstrainedQuadraticFunctionalConstrainedLinearization<Functional, BitVector>;
-        using DefectProjection = Dune::TNNMG::ObstacleDefectProjection;
-        using LineSearchSolver = TrivialSolver;
-
-        using MultiGrid =Dune::Solvers::MultigridStep<MatrixType, VectorType, BitVector>;
-        auto mgStep = std::make_shared<MultiGrid>();
-        auto gssmoother = Dune::Solvers::BlockGSStepFactory<MatrixType, VectorType, BitVector>::create(Dune::Solvers::BlockGS::LocalSolvers::gs());
-        mgStep->setSmoother(&gssmoother);
-        mgStep->setTransferOperators(transfer);
-        mgStep->setMGType(1,3,3);
-        //BitVector dummy(ignore.size());
-        //mgStep->setIgnore(dummy);
-        //mgStep->setIgnore(ignore);
-
-        auto umfpack = Dune::Solvers::UMFPackSolver<MatrixType, VectorType>{};
-        mgStep->basesolver_=&umfpack;
-
-        //std::cout << ENABLE_SUITESPARSE << std::endl;
-        //std::cout << HAVE_SUITESPARSE_UMFPACK << std::endl;
-        using Step = Dune::TNNMG::TNNMGStep<Functional, BitVector, Linearization, DefectProjection, LineSearchSolver>;
-        using Solver = LoopSolver<VectorType>;
-        using Norm =  EnergyNorm<MatrixType, VectorType>;
-
-        int mu=1;
-        auto projection = DefectProjection();
-        auto step = Step(J, u->data(), nonlinearSmoother, mgStep, mu, projection, LineSearchSolver());
-        step.setIgnore(ignore);
-        //mgStep->setProblem(M_dtA_dune, u->data(), M_rhs_dune);
-        auto norm = Norm(M_dtA_dune);
-        //auto solver = Solver(&(*mgStep), 1e9, 1e-8, &norm, Solver::FULL);
-        auto solver = Solver(&step, 1e9, 0, &norm, Solver::FULL);
-
-
-        solver.addCriterion(
-            [&](){
-            return Dune::formatString("   % 12.5e", J(u->data()));
-            },
-            "   energy      ");
-
-        double initialEnergy = J(u->data());
-        solver.addCriterion(
-            [&](){
-            static double oldEnergy=initialEnergy;
-            double currentEnergy = J(u->data());
-            double decrease = currentEnergy - oldEnergy;
-            oldEnergy = currentEnergy;
-            return Dune::formatString("   % 12.5e", decrease);
-            },
-            "   decrease    ");
-
-        solver.addCriterion(
-            [&](){
-            return Dune::formatString("   % 12.5e", step.lastDampingFactor());
-            },
-            "   damping     ");
-
-
-        solver.addCriterion(
-            [&](){
-            return Dune::formatString("   % 12d", step.linearization().truncated().count());
-            },
-            "   truncated   ");
+        tnnmg.x = u->get_data();
 
-        std::vector<double> correctionNorms;
-        auto tolerance = 1e-8;
-        solver.addCriterion(Dune::Solvers::correctionNormCriterion(step, norm, tolerance, correctionNorms));
+        tnnmg.correction_norms.clear();
+        tnnmg.old_energy = tnnmg.J(tnnmg.x);
 
+        tnnmg.solver.preprocess();
+        tnnmg.solver.solve();
 
-        solver.preprocess();
-        solver.solve();
+        u->data() = tnnmg.x;
 
 	
         //Dune::MatrixAdapter<MatrixType,VectorType,VectorType> linearOperator(M_dtA_dune);
@@ -1,5 +1,6 @@
 #include <memory>
 #include <iostream>
+#include <type_traits>
 #include <vector>
 
 #include "dune_includes"
@@ -28,25 +29,31 @@ namespace pfasst
   {
     namespace heat_FE
     {
-      using sweeper_t = Heat_FE<dune_sweeper_traits<encap_traits_t, BASE_ORDER, DIMENSION>>;
+      //! `Enabled` is `void` or `FixedNodes<N>`, see `run_sdc()`
+      template<typename Enabled = void>
+      using sweeper_t = Heat_FE<dune_sweeper_traits<encap_traits_t, BASE_ORDER, DIMENSION>, Enabled>;
       using pfasst::transfer_traits;
       using pfasst::contrib::SpectralTransfer;
       using pfasst::SDC;
-      using pfasst::quadrature::QuadratureType;
-      using heat_FE_sdc_t = SDC<SpectralTransfer<transfer_traits<sweeper_t, sweeper_t, 1>>>;
-
-      shared_ptr<heat_FE_sdc_t> run_sdc(const size_t nelements, const size_t basisorder, const size_t dim, const size_t nnodes,
-                                       const QuadratureType& quad_type, const double& t_0,
-                                       const double& dt, const double& t_end, const size_t niter)
+      using pfasst::quadrature::IQuadrature;
+      template<typename Enabled = void>
+      using heat_FE_sdc_t = SDC<SpectralTransfer<transfer_traits<sweeper_t<Enabled>, sweeper_t<Enabled>, 1>>>;
+
+      /**
+       * Runs SDC with the sweeper for @p Enabled, i.e. with a node count fixed at compile time for
+       * `FixedNodes<N>` and with the runtime sweeper for `void`.
+       */
+      template<typename Enabled>
+      shared_ptr<heat_FE_sdc_t<Enabled>> run_sdc(const size_t nelements, const size_t basisorder, const size_t dim,
+                                                 const shared_ptr<IQuadrature<double>>& quadrature, const double& t_0,
+                                                 const double& dt, const double& t_end, const size_t niter)
       {
-        using pfasst::quadrature::quadrature_factory;
-
-        auto sdc = std::make_shared<heat_FE_sdc_t>();
+        auto sdc = std::make_shared<heat_FE_sdc_t<Enabled>>();
         auto FinEl   = make_shared<fe_manager>(nelements,1); 
-        auto sweeper = std::make_shared<sweeper_t>(FinEl, 0);
+        auto sweeper = std::make_shared<sweeper_t<Enabled>>(FinEl, 0);
 
 
-        sweeper->quadrature() = quadrature_factory<double>(nnodes, quad_type);
+        sweeper->quadrature() = quadrature;
 
         //sweeper->set_abs_residual_tol(1e-8);
 	
@@ -125,11 +132,10 @@ namespace pfasst
   int main(int argc, char** argv) {
     using pfasst::config::get_value;
     using pfasst::quadrature::QuadratureType;
-    using pfasst::examples::heat_FE::Heat_FE;
-
-    using sweeper_t = Heat_FE<pfasst::examples::heat_FE::dune_sweeper_traits<encap_traits_t, BASE_ORDER, DIMENSION>>;
+    using pfasst::quadrature::quadrature_factory;
+    using pfasst::examples::heat_FE::sweeper_t;
 
-    pfasst::init(argc, argv, sweeper_t::init_opts);
+    pfasst::init(argc, argv, sweeper_t<>::init_opts);
 
     auto const   nelements = pfasst::config::get_value<size_t>("num_elements", 3); 
     const size_t nnodes    = get_value<size_t>("num_nodes", 3);
@@ -153,7 +159,12 @@ namespace pfasst
     }
     const size_t niter = get_value<size_t>("num_iters", 10);
 
-    pfasst::examples::heat_FE::run_sdc(nelements, BASE_ORDER, DIMENSION, nnodes, quad_type, t_0, dt, t_end, niter);
+    // 3 to 5 nodes run the sweeper with the node count fixed at compile time
+    quadrature_factory<double>(nnodes, quad_type, [&](const shared_ptr<pfasst::quadrature::IQuadrature<double>>& quadrature,
+                                                      auto* tag) {
+      using enabled_t = typename std::remove_pointer<decltype(tag)>::type;
+      pfasst::examples::heat_FE::run_sdc<enabled_t>(nelements, BASE_ORDER, DIMENSION, quadrature, t_0, dt, t_end, niter);
+    });
 
   }
 
@@ -95,9 +95,11 @@ namespace pfasst
           evaluate_rhs_expl(const typename SweeperTrait::time_t& t,
                             const shared_ptr<typename SweeperTrait::encap_t> u) override;*/
 
-          virtual shared_ptr<typename SweeperTrait::encap_t>
+          using IMEX<SweeperTrait, Enabled>::evaluate_rhs_impl;
+          virtual void
           evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
-                            const shared_ptr<typename SweeperTrait::encap_t> u) override;
+                            const shared_ptr<typename SweeperTrait::encap_t> u,
+                            shared_ptr<typename SweeperTrait::encap_t> result) override;
 
           virtual void implicit_solve(shared_ptr<typename SweeperTrait::encap_t> f,
                                       shared_ptr<typename SweeperTrait::encap_t> u,
@@ -105,6 +107,12 @@ namespace pfasst
                                       const typename SweeperTrait::time_t& dt,
                                       const shared_ptr<typename SweeperTrait::encap_t> rhs) override;
 
+          virtual void implicit_solve_batch(const vector<shared_ptr<typename SweeperTrait::encap_t>>& f,
+                                            const vector<shared_ptr<typename SweeperTrait::encap_t>>& u,
+                                            const vector<typename SweeperTrait::time_t>& t,
+                                            const vector<typename SweeperTrait::time_t>& dt,
+                                            const vector<shared_ptr<typename SweeperTrait::encap_t>>& rhs) override;
+
           virtual vector<shared_ptr<typename SweeperTrait::encap_t>>
           compute_error(const typename SweeperTrait::time_t& t);
 
@@ -86,6 +86,8 @@ namespace pfasst
       Heat_FE<SweeperTrait, Enabled>::assemble(Basis &basis){
 
         assembleProblem(basis, this->A_dune, this->M_dune);
+        // the cached operators M + c*A were built from the old matrices
+        this->_impl_operators.clear();
 
 
       };
@@ -95,6 +97,8 @@ namespace pfasst
       Heat_FE<SweeperTrait, Enabled>::assemble(){
 
         assembleProblem(basis, this->A_dune, this->M_dune);
+        // the cached operators M + c*A were built from the old matrices
+        this->_impl_operators.clear();
 
 
       };
@@ -142,10 +146,16 @@ namespace pfasst
         //ML_CLOG(INFO, this->get_logger_id(), "  expl:        " << this->_num_expl_f_evals);
         ML_CLOG(INFO, this->get_logger_id(), "  impl:        " << this->_num_impl_f_evals);
         ML_CLOG(INFO, this->get_logger_id(), "  impl solves: " << this->_num_impl_solves);
+        ML_CLOG(INFO, this->get_logger_id(), "  CG iters:    " << this->_impl_operators.iterations());
+        ML_CLOG_IF(this->_impl_operators.get_recycle() > 0, INFO, this->get_logger_id(),
+                   "  CG saved:    " << this->_impl_operators.saved_iterations() << " (by recycling)");
+        ML_CLOG(INFO, this->get_logger_id(), "  skipped:     " << this->_num_skipped_evaluations);
 
         //this->_num_expl_f_evals = 0;
         this->_num_impl_f_evals = 0;
         this->_num_impl_solves = 0;
+        this->_impl_operators.reset_iteration_counts();
+        this->_num_skipped_evaluations = 0;
       }
 
       template<class SweeperTrait, typename Enabled>
@@ -278,9 +288,10 @@ namespace pfasst
       }*/
 
       template<class SweeperTrait, typename Enabled>
-      shared_ptr<typename SweeperTrait::encap_t>
+      void
       Heat_FE<SweeperTrait, Enabled>::evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
-                                                       const shared_ptr<typename SweeperTrait::encap_t> u)
+                                                       const shared_ptr<typename SweeperTrait::encap_t> u,
+                                                       shared_ptr<typename SweeperTrait::encap_t> result)
       {
 
 
@@ -288,7 +299,7 @@ namespace pfasst
         ML_CVLOG(4, this->get_logger_id(), "evaluating IMPLICIT part at t=" << t);
 
 
-        auto result = this->get_encap_factory().create();
+        result->zero();
 
         double nu =this->_nu;
 
@@ -303,7 +314,6 @@ namespace pfasst
         }
 
         
-        return result;
         
 
 
@@ -360,9 +370,6 @@ namespace pfasst
 
 	
 	
-        Dune::BCRSMatrix<Dune::FieldMatrix<double,1,1> > M_dtA_dune = 	Dune::BCRSMatrix<Dune::FieldMatrix<double,1,1> >(this->A_dune);
-        M_dtA_dune *= (dt * this->_nu);
-        M_dtA_dune += this->M_dune;
 
         /*auto isDirichlet = [] (auto x) {return (x[0]<1e-8 or x[0]>0.999999);};
         std::vector<char> dirichletNodes;
@@ -382,19 +389,10 @@ namespace pfasst
         }*/
 	
 	
-        Dune::MatrixAdapter<MatrixType,VectorType,VectorType> linearOperator(M_dtA_dune);
-
-        Dune::SeqILU0<MatrixType,VectorType,VectorType> preconditioner(M_dtA_dune,1.0);
-
-        Dune::CGSolver<VectorType> cg(linearOperator,
-                              preconditioner,
-                              1e-10, // desired residual reduction factor
-                              5000,    // maximum number of iterations
-                              0);    // verbosity of the solver
-
-        Dune::InverseOperatorResult statistics ;
-
-        cg.apply(u->data(), M_rhs_dune , statistics ); //rhs ist nicht constant!!!!!!!!!
+        // M + dt*nu*A is assembled and factorized once per distinct dt
+        this->_impl_operators.solve(this->M_dune, this->A_dune, dt * this->_nu, u->data(), M_rhs_dune,
+                                    1e-10,  // desired residual reduction factor
+                                    5000);  // maximum number of iterations
 
 
 
@@ -425,6 +423,42 @@ namespace pfasst
 
 
 
+      }
+
+      template<class SweeperTrait, typename Enabled>
+      void
+      Heat_FE<SweeperTrait, Enabled>::implicit_solve_batch(const vector<shared_ptr<typename SweeperTrait::encap_t>>& f,
+                                                          const vector<shared_ptr<typename SweeperTrait::encap_t>>& u,
+                                                          const vector<typename SweeperTrait::time_t>& t,
+                                                          const vector<typename SweeperTrait::time_t>& dt,
+                                                          const vector<shared_ptr<typename SweeperTrait::encap_t>>& rhs)
+      {
+        // the systems M + dt*nu*A only differ in their coefficient, thus one traversal of M and A
+        // per iteration serves all right hand sides
+        vector<typename MatrixType::field_type> coeffs(f.size());
+        vector<VectorType*> u_dune(f.size());
+        vector<const VectorType*> rhs_dune(f.size());
+        for (size_t k = 0; k < f.size(); ++k) {
+          coeffs[k] = dt[k] * this->_nu;
+          u_dune[k] = &(u[k]->data());
+          rhs_dune[k] = &(rhs[k]->get_data());
+        }
+
+        this->_impl_operators.solve_batch(this->M_dune, this->A_dune, coeffs, u_dune, rhs_dune,
+                                          1e-10,  // desired residual reduction factor
+                                          5000);  // maximum number of iterations
+
+        for (size_t k = 0; k < f.size(); ++k) {
+          ML_CVLOG(4, this->get_logger_id(),
+                   "IMPLICIT spatial SOLVE at t=" << t[k] << " with dt=" << dt[k] << " (batched)");
+
+          // f = (M u - rhs) / dt
+          this->M_dune.mv(u[k]->get_data(), f[k]->data());
+          f[k]->data() -= rhs[k]->get_data();
+          f[k]->data() *= 1.0 / dt[k];
+        }
+
+        this->_num_impl_solves += f.size();
       }
     }  // ::pfasst::examples::heat1
   }  // ::pfasst::examples
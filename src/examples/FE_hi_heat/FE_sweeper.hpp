@@ -16,6 +16,7 @@ using std::vector;
 
 //#include "../../finite_element_stuff/fe_manager.hpp"
 #include "fe_manager_hi.hpp"
+#include "sum_factorization.hpp"
 
 
 #ifndef PI
@@ -91,15 +92,25 @@ namespace pfasst
           //std::shared_ptr<BasisFunction> basis;
           std::shared_ptr<Dune::Functions::PQkNodalBasis<GridType::LeafGridView,SweeperTrait::BASE_ORDER>> basis; 
 
+          /**
+           * Matrix-free replacement of `M_dune` and `A_dune`, which then stay empty.
+           *
+           * Set up instead of assembling when the runtime parameter `matrix_free` is given; CG solves
+           * are then preconditioned by Jacobi.
+           */
+          std::shared_ptr<SumFactorizedOperator<GridType::dimension>> _matrix_free;
+
 
         protected:
           /*virtual shared_ptr<typename SweeperTrait::encap_t>
           evaluate_rhs_expl(const typename SweeperTrait::time_t& t,
                             const shared_ptr<typename SweeperTrait::encap_t> u) override;*/
 
-          virtual shared_ptr<typename SweeperTrait::encap_t>
+          using IMEX<SweeperTrait, Enabled>::evaluate_rhs_impl;
+          virtual void
           evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
-                            const shared_ptr<typename SweeperTrait::encap_t> u) override;
+                            const shared_ptr<typename SweeperTrait::encap_t> u,
+                            shared_ptr<typename SweeperTrait::encap_t> result) override;
 
           virtual void implicit_solve(shared_ptr<typename SweeperTrait::encap_t> f,
                                       shared_ptr<typename SweeperTrait::encap_t> u,
@@ -107,6 +118,12 @@ namespace pfasst
                                       const typename SweeperTrait::time_t& dt,
                                       const shared_ptr<typename SweeperTrait::encap_t> rhs) override;
 
+          virtual void implicit_solve_batch(const vector<shared_ptr<typename SweeperTrait::encap_t>>& f,
+                                            const vector<shared_ptr<typename SweeperTrait::encap_t>>& u,
+                                            const vector<typename SweeperTrait::time_t>& t,
+                                            const vector<typename SweeperTrait::time_t>& dt,
+                                            const vector<shared_ptr<typename SweeperTrait::encap_t>>& rhs) override;
+
           virtual vector<shared_ptr<typename SweeperTrait::encap_t>>
           compute_error(const typename SweeperTrait::time_t& t);
 
@@ -143,6 +160,15 @@ namespace pfasst
           size_t get_num_dofs() const;
 
           shared_ptr<GridType> get_grid() const;
+
+          virtual void mass_mv(const VectorType& x, VectorType& y) const override;
+          virtual void mass_mmv(const VectorType& x, VectorType& y) const override;
+
+          //! @{
+          //! Copies of the assembled matrices; there are none with `matrix_free`, use mass_mv() instead.
+          shared_ptr<MatrixType> get_M_dune();
+          shared_ptr<MatrixType> get_A_dune();
+          //! @}
       };
     }  // ::pfasst::examples::heat_FE
   }  // ::pfasst::examples
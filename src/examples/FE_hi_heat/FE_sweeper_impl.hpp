@@ -8,6 +8,7 @@
 #include <complex>
 #include <functional>
 #include <memory>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 using std::shared_ptr;
@@ -50,7 +51,11 @@ namespace pfasst
         //this->FinEl = FinEl;
         this->basis = basis;
 	    
-        assembleProblem(basis, this->A_dune, this->M_dune);
+        if (config::get_value<bool>("matrix_free", false)) {
+          this->_matrix_free = std::make_shared<SumFactorizedOperator<GridType::dimension>>(basis);
+        } else {
+          assembleProblem(basis, this->A_dune, this->M_dune);
+        }
 
         const auto bs = basis->size();
         std::cout << "Finite Element basis consists of " <<  basis->size() << " elements " << std::endl;
@@ -107,7 +112,13 @@ namespace pfasst
       void
       Heat_FE<SweeperTrait, Enabled>::assemble(Basis &basis){
 
-        assembleProblem(basis, this->A_dune, this->M_dune);
+        if (this->_matrix_free) {
+          this->_matrix_free = std::make_shared<SumFactorizedOperator<GridType::dimension>>(basis);
+        } else {
+          assembleProblem(basis, this->A_dune, this->M_dune);
+        }
+        // the cached operators M + c*A were built from the old matrices
+        this->_impl_operators.clear();
 
 
       };
@@ -116,7 +127,7 @@ namespace pfasst
       void
       Heat_FE<SweeperTrait, Enabled>::assemble(){
 
-        assembleProblem(basis, this->A_dune, this->M_dune);
+        this->assemble(this->basis);
 
 
       };
@@ -164,10 +175,16 @@ namespace pfasst
         //ML_CLOG(INFO, this->get_logger_id(), "  expl:        " << this->_num_expl_f_evals);
         ML_CLOG(INFO, this->get_logger_id(), "  impl:        " << this->_num_impl_f_evals);
         ML_CLOG(INFO, this->get_logger_id(), "  impl solves: " << this->_num_impl_solves);
+        ML_CLOG(INFO, this->get_logger_id(), "  CG iters:    " << this->_impl_operators.iterations());
+        ML_CLOG_IF(this->_impl_operators.get_recycle() > 0, INFO, this->get_logger_id(),
+                   "  CG saved:    " << this->_impl_operators.saved_iterations() << " (by recycling)");
+        ML_CLOG(INFO, this->get_logger_id(), "  skipped:     " << this->_num_skipped_evaluations);
 
         //this->_num_expl_f_evals = 0;
         this->_num_impl_f_evals = 0;
         this->_num_impl_solves = 0;
+        this->_impl_operators.reset_iteration_counts();
+        this->_num_skipped_evaluations = 0;
       }
 
       template<class SweeperTrait, typename Enabled>
@@ -303,9 +320,10 @@ namespace pfasst
       }*/
 
       template<class SweeperTrait, typename Enabled>
-      shared_ptr<typename SweeperTrait::encap_t>
+      void
       Heat_FE<SweeperTrait, Enabled>::evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
-                                                       const shared_ptr<typename SweeperTrait::encap_t> u)
+                                                       const shared_ptr<typename SweeperTrait::encap_t> u,
+                                                       shared_ptr<typename SweeperTrait::encap_t> result)
       {
 
 
@@ -313,17 +331,21 @@ namespace pfasst
         ML_CVLOG(4, this->get_logger_id(), "evaluating IMPLICIT part at t=" << t);
 
 
-        auto result = this->get_encap_factory().create();
+        result->zero();
 
         double nu =this->_nu;
 
+        if (this->_matrix_free) {
+          this->_matrix_free->apply(0.0, -nu, u->get_data(), result->data());
+          return;
+        }
+
         this->A_dune.mmv(u->get_data(), result->data());
 
 
         result->data() *= nu;
 
 
-        return result;
 
 
       }
@@ -394,9 +416,6 @@ namespace pfasst
 
 	
 	
-        Dune::BCRSMatrix<Dune::FieldMatrix<double,1,1> > M_dtA_dune = 	Dune::BCRSMatrix<Dune::FieldMatrix<double,1,1> >(this->A_dune);
-        M_dtA_dune *= (dt * this->_nu);
-        M_dtA_dune += this->M_dune;
 
         /*auto isDirichlet = [] (auto x) {return (x[0]<1e-8 or x[0]>0.999999);};
 
@@ -418,19 +437,25 @@ namespace pfasst
         }*/
 	
 	
-        Dune::MatrixAdapter<MatrixType,VectorType,VectorType> linearOperator(M_dtA_dune);
-
-        Dune::SeqILU0<MatrixType,VectorType,VectorType> preconditioner(M_dtA_dune,1.0);
-
-        Dune::CGSolver<VectorType> cg(linearOperator,
-                              preconditioner,
-                              1e-10, // desired residual reduction factor
-                              5000,    // maximum number of iterations
-                              0);    // verbosity of the solver
-
-        Dune::InverseOperatorResult statistics ;
-
-        cg.apply(u->data(), M_rhs_dune , statistics ); //rhs ist nicht constant!!!!!!!!!
+        if (this->_matrix_free) {
+          const auto M_dtA = this->_matrix_free->combination(1.0, dt * this->_nu);
+          Dune::MatrixAdapter<typename std::decay<decltype(M_dtA)>::type, VectorType, VectorType> linearOperator(M_dtA);
+
+          const MatrixType diagonal = this->_matrix_free->diagonal(1.0, dt * this->_nu);
+          Dune::SeqJacobi<MatrixType, VectorType, VectorType> preconditioner(diagonal, 1, 1.0);
+
+          Dune::CGSolver<VectorType> cg(linearOperator, preconditioner,
+                                        1e-10,  // desired residual reduction factor
+                                        5000,   // maximum number of iterations
+                                        0);     // verbosity of the solver
+          Dune::InverseOperatorResult statistics;
+          cg.apply(u->data(), M_rhs_dune, statistics);
+        } else {
+          // M + dt*nu*A is assembled and factorized once per distinct dt
+          this->_impl_operators.solve(this->M_dune, this->A_dune, dt * this->_nu, u->data(), M_rhs_dune,
+                                      1e-10,  // desired residual reduction factor
+                                      5000);  // maximum number of iterations
+        }
 
 
 
@@ -444,7 +469,7 @@ namespace pfasst
 	
         Dune::BlockVector<Dune::FieldVector<double,1> > M_u;
         M_u.resize(u->get_data().size());
-        this->M_dune.mv(u->get_data(), M_u);
+        this->mass_mv(u->get_data(), M_u);
 	
 
         //std::cout << "f_impl mit impl_solve" << std::endl;
@@ -462,6 +487,90 @@ namespace pfasst
 
 
 
+      }
+
+      template<class SweeperTrait, typename Enabled>
+      void
+      Heat_FE<SweeperTrait, Enabled>::implicit_solve_batch(const vector<shared_ptr<typename SweeperTrait::encap_t>>& f,
+                                                          const vector<shared_ptr<typename SweeperTrait::encap_t>>& u,
+                                                          const vector<typename SweeperTrait::time_t>& t,
+                                                          const vector<typename SweeperTrait::time_t>& dt,
+                                                          const vector<shared_ptr<typename SweeperTrait::encap_t>>& rhs)
+      {
+        if (this->_matrix_free) {
+          IMEX<SweeperTrait, Enabled>::implicit_solve_batch(f, u, t, dt, rhs);
+          return;
+        }
+
+        // the systems M + dt*nu*A only differ in their coefficient, thus one traversal of M and A
+        // per iteration serves all right hand sides
+        vector<typename MatrixType::field_type> coeffs(f.size());
+        vector<VectorType*> u_dune(f.size());
+        vector<const VectorType*> rhs_dune(f.size());
+        for (size_t k = 0; k < f.size(); ++k) {
+          coeffs[k] = dt[k] * this->_nu;
+          u_dune[k] = &(u[k]->data());
+          rhs_dune[k] = &(rhs[k]->get_data());
+        }
+
+        this->_impl_operators.solve_batch(this->M_dune, this->A_dune, coeffs, u_dune, rhs_dune,
+                                          1e-10,  // desired residual reduction factor
+                                          5000);  // maximum number of iterations
+
+        for (size_t k = 0; k < f.size(); ++k) {
+          ML_CVLOG(4, this->get_logger_id(),
+                   "IMPLICIT spatial SOLVE at t=" << t[k] << " with dt=" << dt[k] << " (batched)");
+
+          // f = (M u - rhs) / dt
+          this->M_dune.mv(u[k]->get_data(), f[k]->data());
+          f[k]->data() -= rhs[k]->get_data();
+          f[k]->data() *= 1.0 / dt[k];
+        }
+
+        this->_num_impl_solves += f.size();
+      }
+      template<class SweeperTrait, typename Enabled>
+      void
+      Heat_FE<SweeperTrait, Enabled>::mass_mv(const VectorType& x, VectorType& y) const
+      {
+        if (this->_matrix_free) {
+          this->_matrix_free->apply(1.0, 0.0, x, y);
+        } else {
+          this->M_dune.mv(x, y);
+        }
+      }
+
+      template<class SweeperTrait, typename Enabled>
+      void
+      Heat_FE<SweeperTrait, Enabled>::mass_mmv(const VectorType& x, VectorType& y) const
+      {
+        if (this->_matrix_free) {
+          this->_matrix_free->combination(1.0, 0.0).usmv(-1.0, x, y);
+        } else {
+          this->M_dune.mmv(x, y);
+        }
+      }
+
+      template<class SweeperTrait, typename Enabled>
+      shared_ptr<MatrixType>
+      Heat_FE<SweeperTrait, Enabled>::get_M_dune()
+      {
+        if (this->_matrix_free) {
+          ML_CLOG(ERROR, this->get_logger_id(), "there is no assembled mass matrix with matrix_free");
+          throw std::runtime_error("no assembled mass matrix");
+        }
+        return IMEX<SweeperTrait, Enabled>::get_M_dune();
+      }
+
+      template<class SweeperTrait, typename Enabled>
+      shared_ptr<MatrixType>
+      Heat_FE<SweeperTrait, Enabled>::get_A_dune()
+      {
+        if (this->_matrix_free) {
+          ML_CLOG(ERROR, this->get_logger_id(), "there is no assembled stiffness matrix with matrix_free");
+          throw std::runtime_error("no assembled stiffness matrix");
+        }
+        return IMEX<SweeperTrait, Enabled>::get_A_dune();
       }
     }  // ::pfasst::examples::heat1
   }  // ::pfasst::examples
@@ -0,0 +1,331 @@
+#ifndef _PFASST__EXAMPLES__FE_HI_HEAT__SUM_FACTORIZATION_HPP_
+#define _PFASST__EXAMPLES__FE_HI_HEAT__SUM_FACTORIZATION_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include <dune/common/fvector.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+#include <dune/istl/matrixindexset.hh>
+#include <dune/functions/functionspacebases/interpolate.hh>
+
+
+/**
+ * Matrix-free mass and stiffness matrix of a PQk basis on an equidistant tensor-product grid.
+ *
+ * On such a grid both matrices are Kronecker products of the 1D matrices of each direction,
+ * @f$ M = M_{d-1} \otimes \dots \otimes M_0 @f$ and
+ * @f$ A = \sum_d M_{d-1} \otimes \dots \otimes K_d \otimes \dots \otimes M_0 @f$, with the same
+ * sign convention as `assembleProblem()` of this example.
+ * Only the banded 1D matrices and the map from basis indices to lexicographic lattice indices are
+ * stored; an application sweeps the 1D matrices along every direction (sum factorization).
+ *
+ * The lattice is recovered from the coordinates of the Lagrange nodes, thus any basis whose nodes
+ * form an equidistant lattice with @f$ k @f$ nodes per cell and direction is accepted; everything
+ * else is rejected by the constructor.
+ *
+ * Applications may run concurrently; each one borrows its work vectors from a pool kept by the
+ * operator, thus repeated applications do not allocate.
+ */
+template<int dim>
+class SumFactorizedOperator {
+
+  using VectorT = Dune::BlockVector<Dune::FieldVector<double, 1>>;
+  using MatrixT = Dune::BCRSMatrix<Dune::FieldMatrix<double, 1, 1>>;
+
+  //! banded @f$ n \times n @f$ matrix with @f$ 2k+1 @f$ diagonals, row major
+  struct Banded {
+    size_t n = 0;
+    int k = 0;
+    std::vector<double> values;
+
+    double& operator()(size_t i, size_t j) { return values[i * (2 * k + 1) + (j + k - i)]; }
+    double operator()(size_t i, size_t j) const { return values[i * (2 * k + 1) + (j + k - i)]; }
+  };
+
+  int order;
+  std::array<size_t, dim> extent;
+  std::array<Banded, dim> mass1d, stiffness1d;
+  //! lexicographic lattice index of each basis function
+  std::vector<size_t> lexicographic;
+
+  //! work vectors of one application, in lexicographic order
+  struct Scratch {
+    std::vector<double> in, out, t, s;
+  };
+  mutable std::mutex scratch_mutex;
+  mutable std::vector<std::unique_ptr<Scratch>> scratch_pool;
+
+public:
+  /**
+   * View of @f$ a M + b A @f$ with the interface `Dune::MatrixAdapter` expects of a matrix.
+   */
+  class Combination {
+    const SumFactorizedOperator &op;
+    double a, b;
+
+  public:
+    using field_type = double;
+
+    Combination(const SumFactorizedOperator &op, double a, double b) : op(op), a(a), b(b) {}
+
+    void mv(const VectorT &x, VectorT &y) const { op.apply(a, b, x, y); }
+
+    void usmv(const double alpha, const VectorT &x, VectorT &y) const { op.usmv(alpha, a, b, x, y); }
+  };
+
+  template<class Basis>
+  explicit SumFactorizedOperator(const std::shared_ptr<Basis> &basis) {
+    const size_t size = basis->size();
+
+    auto localView = basis->localView();
+    localView.bind(*basis->gridView().template begin<0>());
+    order = localView.tree().finiteElement().localBasis().order();
+
+    // node coordinates, one direction at a time
+    std::array<std::vector<double>, dim> coords;
+    std::array<double, dim> lower, delta;
+    for (int d = 0; d < dim; d++) {
+      Dune::Functions::interpolate(*basis, coords[d], [d](const Dune::FieldVector<double, dim> &x) { return x[d]; });
+
+      std::vector<double> sorted(coords[d]);
+      std::sort(sorted.begin(), sorted.end());
+      const double tol = 1e-10 * std::max(1.0, sorted.back() - sorted.front());
+      sorted.erase(std::unique(sorted.begin(), sorted.end(), [tol](double x, double y) { return y - x < tol; }),
+                   sorted.end());
+
+      extent[d] = sorted.size();
+      if (extent[d] < 2 || (extent[d] - 1) % order != 0)
+        throw std::runtime_error("sum factorization needs an equidistant tensor-product grid");
+
+      lower[d] = sorted.front();
+      delta[d] = (sorted.back() - sorted.front()) / (extent[d] - 1);
+      for (size_t i = 0; i < extent[d]; i++)
+        if (std::abs(sorted[i] - lower[d] - i * delta[d]) > tol)
+          throw std::runtime_error("sum factorization needs an equidistant tensor-product grid");
+
+      assemble1d(extent[d], delta[d] * order, mass1d[d], stiffness1d[d]);
+    }
+
+    size_t lattice = 1;
+    for (int d = 0; d < dim; d++)
+      lattice *= extent[d];
+    if (lattice != size)
+      throw std::runtime_error("sum factorization needs an equidistant tensor-product grid");
+
+    lexicographic.resize(size);
+    std::vector<char> taken(size, 0);
+    for (size_t i = 0; i < size; i++) {
+      size_t index = 0;
+      for (int d = dim - 1; d >= 0; d--)
+        index = index * extent[d] + size_t(std::lround((coords[d][i] - lower[d]) / delta[d]));
+      if (taken[index])
+        throw std::runtime_error("sum factorization needs an equidistant tensor-product grid");
+      taken[index] = 1;
+      lexicographic[i] = index;
+    }
+  }
+
+  size_t size() const { return lexicographic.size(); }
+
+  //! @f$ a M + b A @f$ for use with `Dune::MatrixAdapter`
+  Combination combination(double a, double b) const { return Combination(*this, a, b); }
+
+  //! @f$ y = a M x + b A x @f$
+  void apply(const double a, const double b, const VectorT &x, VectorT &y) const {
+    std::unique_ptr<Scratch> scratch = acquire_scratch();
+    multiply(a, b, x, *scratch);
+
+    y.resize(size());
+    for (size_t i = 0; i < size(); i++)
+      y[i] = scratch->out[lexicographic[i]];
+    release_scratch(std::move(scratch));
+  }
+
+  //! @f$ y \mathrel{+}= \alpha (a M x + b A x) @f$
+  void usmv(const double alpha, const double a, const double b, const VectorT &x, VectorT &y) const {
+    std::unique_ptr<Scratch> scratch = acquire_scratch();
+    multiply(a, b, x, *scratch);
+
+    for (size_t i = 0; i < size(); i++)
+      y[i] += alpha * scratch->out[lexicographic[i]];
+    release_scratch(std::move(scratch));
+  }
+
+  /**
+   * Diagonal of @f$ a M + b A @f$ as sparse matrix, e.g. for `Dune::SeqJacobi`.
+   *
+   * Its memory is that of a vector, unlike the assembled operator.
+   */
+  MatrixT diagonal(const double a, const double b) const {
+    const size_t n = size();
+
+    Dune::MatrixIndexSet pattern(n, n);
+    for (size_t i = 0; i < n; i++)
+      pattern.add(i, i);
+    MatrixT diag;
+    pattern.exportIdx(diag);
+
+    for (size_t i = 0; i < n; i++) {
+      std::array<size_t, dim> multi;
+      size_t rest = lexicographic[i];
+      for (int d = 0; d < dim; d++) {
+        multi[d] = rest % extent[d];
+        rest /= extent[d];
+      }
+
+      double m = 1.0, k = 0.0;
+      for (int d = 0; d < dim; d++) {
+        k = k * mass1d[d](multi[d], multi[d]) + m * stiffness1d[d](multi[d], multi[d]);
+        m *= mass1d[d](multi[d], multi[d]);
+      }
+      diag[i][i] = a * m + b * k;
+    }
+    return diag;
+  }
+
+private:
+  std::unique_ptr<Scratch> acquire_scratch() const {
+    std::lock_guard<std::mutex> lock(scratch_mutex);
+    if (scratch_pool.empty())
+      return std::unique_ptr<Scratch>(new Scratch);
+    std::unique_ptr<Scratch> scratch = std::move(scratch_pool.back());
+    scratch_pool.pop_back();
+    return scratch;
+  }
+
+  void release_scratch(std::unique_ptr<Scratch> scratch) const {
+    std::lock_guard<std::mutex> lock(scratch_mutex);
+    scratch_pool.push_back(std::move(scratch));
+  }
+
+  //! `scratch.out` becomes @f$ a M x + b A x @f$ in lexicographic order
+  void multiply(const double a, const double b, const VectorT &x, Scratch &scratch) const {
+    const size_t n = size();
+    std::vector<double> &in = scratch.in, &out = scratch.out, &t = scratch.t, &s = scratch.s;
+    in.resize(n);
+    out.assign(n, 0.0);
+    s.resize(n);
+    for (size_t i = 0; i < n; i++)
+      in[lexicographic[i]] = x[i];
+
+    // one sweep per direction for every term of the Kronecker sums
+    if (a != 0) {
+      t = in;
+      for (int d = 0; d < dim; d++) {
+        sweep(mass1d[d], d, t, s);
+        t.swap(s);
+      }
+      for (size_t i = 0; i < n; i++)
+        out[i] += a * t[i];
+    }
+    if (b != 0) {
+      for (int e = 0; e < dim; e++) {
+        t = in;
+        for (int d = 0; d < dim; d++) {
+          sweep(d == e ? stiffness1d[d] : mass1d[d], d, t, s);
+          t.swap(s);
+        }
+        for (size_t i = 0; i < n; i++)
+          out[i] += b * t[i];
+      }
+    }
+  }
+
+  //! applies @p mat along direction @p d of the lexicographic lattice
+  void sweep(const Banded &mat, const int d, const std::vector<double> &in, std::vector<double> &out) const {
+    size_t stride = 1;
+    for (int e = 0; e < d; e++)
+      stride *= extent[e];
+    const size_t n = extent[d];
+    const size_t outer = in.size() / (stride * n);
+    const size_t k = mat.k;
+
+    for (size_t o = 0; o < outer; o++)
+      for (size_t i = 0; i < n; i++) {
+        const size_t jmin = i >= k ? i - k : 0;
+        const size_t jmax = std::min(n - 1, i + k);
+        double *row = &out[(o * n + i) * stride];
+        std::fill(row, row + stride, 0.0);
+        for (size_t j = jmin; j <= jmax; j++) {
+          const double v = mat(i, j);
+          const double *col = &in[(o * n + j) * stride];
+          for (size_t s = 0; s < stride; s++)
+            row[s] += v * col[s];
+        }
+      }
+  }
+
+  //! 1D mass and stiffness matrix of @p n nodes and cells of width @p h
+  void assemble1d(const size_t n, const double h, Banded &mass, Banded &stiffness) const {
+    const int k = order;
+    for (Banded *mat : {&mass, &stiffness}) {
+      mat->n = n;
+      mat->k = k;
+      mat->values.assign(n * (2 * k + 1), 0.0);
+    }
+
+    // Gauss-Legendre rule with k+1 points on [0,1], exact for the products of two shape functions
+    std::vector<double> points(k + 1), weights(k + 1);
+    for (int q = 0; q <= k; q++) {
+      double x = std::cos(M_PI * (q + 0.75) / (k + 1.5));
+      double dp = 0;
+      for (int it = 0; it < 100; it++) {
+        double p0 = 1, p1 = x;
+        for (int l = 2; l <= k + 1; l++) {
+          const double p2 = ((2 * l - 1) * x * p1 - (l - 1) * p0) / l;
+          p0 = p1;
+          p1 = p2;
+        }
+        dp = (k + 1) * (x * p1 - p0) / (x * x - 1);
+        const double dx = p1 / dp;
+        x -= dx;
+        if (std::abs(dx) < 1e-15)
+          break;
+      }
+      points[q] = 0.5 * (1 - x);
+      weights[q] = 1.0 / ((1 - x * x) * dp * dp);
+    }
+
+    // Lagrange polynomials of the equidistant nodes i/k
+    auto lagrange = [k](const int i, const double x, double &value, double &derivative) {
+      value = 1;
+      derivative = 0;
+      for (int j = 0; j <= k; j++) {
+        if (j == i)
+          continue;
+        const double factor = (x - double(j) / k) / (double(i - j) / k);
+        derivative = derivative * factor + value / (double(i - j) / k);
+        value *= factor;
+      }
+    };
+
+    std::vector<double> value(k + 1), derivative(k + 1);
+    std::vector<double> elementMass((k + 1) * (k + 1), 0.0), elementStiffness((k + 1) * (k + 1), 0.0);
+    for (int q = 0; q <= k; q++) {
+      for (int i = 0; i <= k; i++)
+        lagrange(i, points[q], value[i], derivative[i]);
+      for (int i = 0; i <= k; i++)
+        for (int j = 0; j <= k; j++) {
+          elementMass[i * (k + 1) + j] += weights[q] * value[i] * value[j] * h;
+          elementStiffness[i * (k + 1) + j] += weights[q] * derivative[i] * derivative[j] / h;
+        }
+    }
+
+    for (size_t cell = 0; cell + 1 < n; cell += k)
+      for (int i = 0; i <= k; i++)
+        for (int j = 0; j <= k; j++) {
+          mass(cell + i, cell + j) += elementMass[i * (k + 1) + j];
+          stiffness(cell + i, cell + j) += elementStiffness[i * (k + 1) + j];
+        }
+  }
+};
+
+#endif  // _PFASST__EXAMPLES__FE_HI_HEAT__SUM_FACTORIZATION_HPP_
@@ -134,10 +134,10 @@ namespace pfasst
             (*w)[j]=0;
         }
 
-        for(int i=0; i<this->M_dune.M(); i++){
-            for(int j=0; j<this->M_dune.M(); j++){
-                if(this->M_dune.exists(i,j))
-                (*w)[i][0]= ((double) (*w)[i][0]) + ((double) this->M_dune[i][j][0][0]);
+        // lumped mass: row sums over the stored entries of M only
+        for (auto row = this->M_dune.begin(); row != this->M_dune.end(); ++row) {
+            for (auto col = row->begin(); col != row->end(); ++col) {
+                (*w)[row.index()][0] += (*col)[0][0];
             }
         }
 
@@ -490,20 +490,18 @@ return result;
       }*/
 
       template<class SweeperTrait, typename Enabled>
-      shared_ptr<typename SweeperTrait::encap_t>
+      void
       Heat_FE<SweeperTrait, Enabled>::evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
-                                                       const shared_ptr<typename SweeperTrait::encap_t> u)
+                                                       const shared_ptr<typename SweeperTrait::encap_t> u,
+                                                       shared_ptr<typename SweeperTrait::encap_t> result)
       {
 	
          ML_CVLOG(4, this->get_logger_id(),  "evaluating IMPLICIT part at t=" << t);
 
 
 
-        auto result = this->get_encap_factory().create();
-        auto u2 = this->get_encap_factory().create();
         double nu =this->_nu;
 
-	u2->zero();
 	for (int i=0; i<u->get_data().size(); ++i)
 	    {
 	    result->data()[i]= -pow(u->get_data()[i], _n+1) * (*w)[i];	
@@ -523,7 +521,6 @@ return result;
 
          }*/
         
-        return result;
       }
 
       template<class SweeperTrait, typename Enabled>
@@ -142,10 +142,10 @@ namespace pfasst
             (*w)[j]=0;
         }
 
-        for(int i=0; i<this->M_dune.M(); i++){
-            for(int j=0; j<this->M_dune.M(); j++){
-                if(this->M_dune.exists(i,j))
-                (*w)[i][0]= ((double) (*w)[i][0]) + ((double) this->M_dune[i][j][0][0]);
+        // lumped mass: row sums over the stored entries of M only
+        for (auto row = this->M_dune.begin(); row != this->M_dune.end(); ++row) {
+            for (auto col = row->begin(); col != row->end(); ++col) {
+                (*w)[row.index()][0] += (*col)[0][0];
             }
         }
 
@@ -166,6 +166,7 @@ namespace pfasst
         IMEX<SweeperTrait, Enabled>::set_options();
 
         this->_nu = config::get_value<spatial_t>("nu", this->_nu);
+        this->_newton.set_options();
 
         int num_nodes = this->get_quadrature()->get_num_nodes();
 
@@ -356,10 +357,12 @@ return result;
         //ML_CLOG(INFO, this->get_logger_id(), "  expl:        " << this->_num_expl_f_evals);
         ML_CLOG(INFO, this->get_logger_id(), "  impl:        " << this->_num_impl_f_evals);
         ML_CLOG(INFO, this->get_logger_id(), "  impl solves: " << this->_num_impl_solves);
+        ML_CLOG(INFO, this->get_logger_id(), "  skipped:     " << this->_num_skipped_evaluations);
 
         //this->_num_expl_f_evals = 0;
         this->_num_impl_f_evals = 0;
         this->_num_impl_solves = 0;
+        this->_num_skipped_evaluations = 0;
       }
 
       template<class SweeperTrait, typename Enabled>
@@ -501,20 +504,18 @@ return result;
       }*/
 
       template<class SweeperTrait, typename Enabled>
-      shared_ptr<typename SweeperTrait::encap_t>
+      void
       Heat_FE<SweeperTrait, Enabled>::evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
-                                                       const shared_ptr<typename SweeperTrait::encap_t> u)
+                                                       const shared_ptr<typename SweeperTrait::encap_t> u,
+                                                       shared_ptr<typename SweeperTrait::encap_t> result)
       {
 	
          ML_CVLOG(4, this->get_logger_id(),  "evaluating IMPLICIT part at t=" << t);
 
 
 
-        auto result = this->get_encap_factory().create();
-        auto u2 = this->get_encap_factory().create();
         double nu =this->_nu;
 
-	u2->zero();
 	for (int i=0; i<u->get_data().size(); ++i)
 	    {
 	    result->data()[i]= -pow(u->get_data()[i], _n+1) * (*w)[i];	
@@ -534,7 +535,6 @@ return result;
 
          }*/
         
-        return result;
       }
 
       template<class SweeperTrait, typename Enabled>
@@ -545,6 +545,8 @@ return result;
                                                     const typename SweeperTrait::time_t& dt,
                                                     const shared_ptr<typename SweeperTrait::encap_t> rhs)
       {
+        // per-solve copy of the forcing state; nodes may be solved concurrently
+        auto newton = this->_newton;
 	
 
 
@@ -561,10 +563,15 @@ return result;
     newton_rhs2.resize(rhs->get_data().size());
     
 	
-        u->zero();
+        // u holds the initial guess prepared by IMEX::initial_guess()
 	for (int i=0; i< 200 ;i++){
 	  Dune::BCRSMatrix<Dune::FieldMatrix<double,1,1> > df = Dune::BCRSMatrix<Dune::FieldMatrix<double,1,1> >(this->M_dune); ///////M
 	  evaluate_f(f, u, dt, rhs);
+	  const spatial_t f_norm = f->data().two_norm();
+	  if (i == 0) {
+	    newton.start(f_norm, this->get_status()->get_abs_res_norm(), this->is_coarse);
+	  }
+	  if (newton.is_enabled() && newton.converged(f_norm)) { break; }
 	  evaluate_df(df, u, dt);
 	  df.mv(u->data(), newton_rhs);
 	  newton_rhs -= f->data();
@@ -605,7 +612,7 @@ return result;
 	  Dune::SeqILU0<MatrixType,VectorType,VectorType> preconditioner(df,1.0);
 	  Dune::CGSolver<VectorType> cg(linearOperator,
                               preconditioner,
-                              1e-1, // desired residual reduction factor
+                              newton.forcing(f_norm), // desired residual reduction factor
                               50,    // maximum number of iterations
                               2);    // verbosity of the solver
 	  Dune::InverseOperatorResult statistics ;
@@ -635,7 +642,7 @@ return result;
          double abbruch=  tmp*f->data() ;	
 
           //if(-abbruch <1e-10){          std::cout << "genauigkeit erreicht " << i << abbruch << std::endl; break; }
-          if(f->data().two_norm() <1e-8){          std::cout << "genauigkeit erreicht " << i << std::endl; break; }
+          if(newton.converged(f->data().two_norm())){          std::cout << "genauigkeit erreicht " << i << std::endl; break; }
           
 	  df.mv(u->data(), residuum->data());
           residuum->data() -= newton_rhs2;
@@ -11,6 +11,7 @@ using std::vector;
 
 //#include <pfasst/sweeper/FE_imex.hpp>
 #include <pfasst/sweeper/FE_impl.hpp>
+#include <pfasst/sweeper/inexact_newton.hpp>
 //#include <pfasst/sweeper/imex.hpp>
 
 #include <pfasst/contrib/fft.hpp>
@@ -79,6 +80,8 @@ namespace pfasst
           double                                     	 _n{1.0};
           double                                      	 _delta{1.0};
           double                                        _abs_newton_tol=1e-10;
+          //! Newton stopping tolerance and forcing terms (`newton_inexact`)
+          pfasst::InexactNewton<double>                 _newton{1e-8, 1e-8};
 	  
 	  pfasst::contrib::FFT<typename traits::encap_t> _fft;
           vector<vector<spatial_t>>                      _lap;
@@ -115,9 +118,11 @@ namespace pfasst
           evaluate_rhs_expl(const typename SweeperTrait::time_t& t,
                             const shared_ptr<typename SweeperTrait::encap_t> u) override;*/
 
-          virtual shared_ptr<typename SweeperTrait::encap_t>
+          using IMEX<SweeperTrait, Enabled>::evaluate_rhs_impl;
+          virtual void
           evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
-                            const shared_ptr<typename SweeperTrait::encap_t> u) override;
+                            const shared_ptr<typename SweeperTrait::encap_t> u,
+                            shared_ptr<typename SweeperTrait::encap_t> result) override;
 
           virtual void implicit_solve(shared_ptr<typename SweeperTrait::encap_t> f,
                                       shared_ptr<typename SweeperTrait::encap_t> u,
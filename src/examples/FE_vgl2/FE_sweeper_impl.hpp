@@ -134,10 +134,10 @@ namespace pfasst
             (*w)[j]=0;
         }
 
-        for(int i=0; i<this->M_dune.M(); i++){
-            for(int j=0; j<this->M_dune.M(); j++){
-                if(this->M_dune.exists(i,j))
-                (*w)[i][0]= ((double) (*w)[i][0]) + ((double) this->M_dune[i][j][0][0]);
+        // lumped mass: row sums over the stored entries of M only
+        for (auto row = this->M_dune.begin(); row != this->M_dune.end(); ++row) {
+            for (auto col = row->begin(); col != row->end(); ++col) {
+                (*w)[row.index()][0] += (*col)[0][0];
             }
         }
 
@@ -158,6 +158,7 @@ namespace pfasst
         IMEX<SweeperTrait, Enabled>::set_options();
 
         this->_nu = config::get_value<spatial_t>("nu", this->_nu);
+        this->_newton.set_options();
 
         int num_nodes = this->get_quadrature()->get_num_nodes();
 
@@ -345,10 +346,12 @@ return result;
         //ML_CLOG(INFO, this->get_logger_id(), "  expl:        " << this->_num_expl_f_evals);
         ML_CLOG(INFO, this->get_logger_id(), "  impl:        " << this->_num_impl_f_evals);
         ML_CLOG(INFO, this->get_logger_id(), "  impl solves: " << this->_num_impl_solves);
+        ML_CLOG(INFO, this->get_logger_id(), "  skipped:     " << this->_num_skipped_evaluations);
 
         //this->_num_expl_f_evals = 0;
         this->_num_impl_f_evals = 0;
         this->_num_impl_solves = 0;
+        this->_num_skipped_evaluations = 0;
       }
 
       template<class SweeperTrait, typename Enabled>
@@ -490,20 +493,18 @@ return result;
       }*/
 
       template<class SweeperTrait, typename Enabled>
-      shared_ptr<typename SweeperTrait::encap_t>
+      void
       Heat_FE<SweeperTrait, Enabled>::evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
-                                                       const shared_ptr<typename SweeperTrait::encap_t> u)
+                                                       const shared_ptr<typename SweeperTrait::encap_t> u,
+                                                       shared_ptr<typename SweeperTrait::encap_t> result)
       {
 	
          ML_CVLOG(4, this->get_logger_id(),  "evaluating IMPLICIT part at t=" << t);
 
 
 
-        auto result = this->get_encap_factory().create();
-        auto u2 = this->get_encap_factory().create();
         double nu =this->_nu;
 
-	u2->zero();
 	for (int i=0; i<u->get_data().size(); ++i)
 	    {
 	    result->data()[i]= -pow(u->get_data()[i], _n+1) * (*w)[i];	
@@ -523,7 +524,6 @@ return result;
 
          }*/
         
-        return result;
       }
 
       template<class SweeperTrait, typename Enabled>
@@ -534,6 +534,8 @@ return result;
                                                     const typename SweeperTrait::time_t& dt,
                                                     const shared_ptr<typename SweeperTrait::encap_t> rhs)
       {
+        // per-solve copy of the forcing state; nodes may be solved concurrently
+        auto newton = this->_newton;
 	
 
 
@@ -676,7 +678,9 @@ return result;
             ausgabe = Solver::FULL;
         }
 
-        auto solver = Solver(&step, 200, 1e-8, &norm, ausgabe);
+        // TNNMG has no inner linear solves to force; only its stopping tolerance follows the sweeper residual
+        newton.start(0.0, this->get_status()->get_abs_res_norm(), this->is_coarse);
+        auto solver = Solver(&step, 200, newton.outer_tolerance(), &norm, ausgabe);
 
         //solver.addCriterion(
             //[&](){
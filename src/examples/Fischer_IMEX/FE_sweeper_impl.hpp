@@ -241,10 +241,16 @@ namespace pfasst
         //ML_CLOG(INFO, this->get_logger_id(), "  expl:        " << this->_num_expl_f_evals);
         ML_CLOG(INFO, this->get_logger_id(), "  impl:        " << this->_num_impl_f_evals);
         ML_CLOG(INFO, this->get_logger_id(), "  impl solves: " << this->_num_impl_solves);
+        ML_CLOG(INFO, this->get_logger_id(), "  CG iters:    " << this->_impl_operators.iterations());
+        ML_CLOG_IF(this->_impl_operators.get_recycle() > 0, INFO, this->get_logger_id(),
+                   "  CG saved:    " << this->_impl_operators.saved_iterations() << " (by recycling)");
+        ML_CLOG(INFO, this->get_logger_id(), "  skipped:     " << this->_num_skipped_evaluations);
 
         //this->_num_expl_f_evals = 0;
         this->_num_impl_f_evals = 0;
         this->_num_impl_solves = 0;
+        this->_impl_operators.reset_iteration_counts();
+        this->_num_skipped_evaluations = 0;
       }
 
       template<class SweeperTrait, typename Enabled>
@@ -366,19 +372,18 @@ namespace pfasst
       }
 
       template<class SweeperTrait, typename Enabled>
-      shared_ptr<typename SweeperTrait::encap_t>
+      void
       Heat_FE<SweeperTrait, Enabled>::evaluate_rhs_expl(const typename SweeperTrait::time_t& t,
-                                                       const shared_ptr<typename SweeperTrait::encap_t> u)
+                                                       const shared_ptr<typename SweeperTrait::encap_t> u,
+                                                       shared_ptr<typename SweeperTrait::encap_t> result)
       {
         UNUSED(u);
         ML_CVLOG(4, this->get_logger_id(),  "evaluating EXPLICIT part at t=" << t);
 
      
-        auto result = this->get_encap_factory().create();
-        auto u2 = this->get_encap_factory().create();
+        auto u2 = this->get_encap_factory().create_uninitialized();
         double nu =this->_nu;
 
-	u2->zero();
 	for (int i=0; i<u->get_data().size(); ++i)
 	    {
 	    u2->data()[i]= -pow(u->get_data()[i], _n+1);	
@@ -394,22 +399,21 @@ namespace pfasst
 	
         this->_num_expl_f_evals++;
 	
-        return result;
 
       }
 
       template<class SweeperTrait, typename Enabled>
-      shared_ptr<typename SweeperTrait::encap_t>
+      void
       Heat_FE<SweeperTrait, Enabled>::evaluate_rhs_impl(const typename SweeperTrait::time_t& t,
-                                                       const shared_ptr<typename SweeperTrait::encap_t> u)
+                                                       const shared_ptr<typename SweeperTrait::encap_t> u,
+                                                       shared_ptr<typename SweeperTrait::encap_t> result)
       {
 	
          ML_CVLOG(4, this->get_logger_id(),  "evaluating IMPLICIT part at t=" << t);
 
 
 
-        auto result = this->get_encap_factory().create();
-        auto u2 = this->get_encap_factory().create();
+        result->zero();
         double nu =this->_nu;
 
         this->A_dune.mmv(u->get_data(), result->data());
@@ -424,7 +428,6 @@ namespace pfasst
           std::cout << "f u " << result->data()[i] << std::endl;
         }*/
         
-        return result;
         
         
         
@@ -452,9 +455,6 @@ namespace pfasst
 
 	
 	
-        Dune::BCRSMatrix<Dune::FieldMatrix<double,1,1> > M_dtA_dune = 	Dune::BCRSMatrix<Dune::FieldMatrix<double,1,1> >(this->A_dune);
-        M_dtA_dune *= (dt * this->_nu);
-        M_dtA_dune += this->M_dune;
 
         /*auto isDirichlet = [] (auto x) {return (x[0]<1e-8 or x[0]>0.999999);};
         std::vector<char> dirichletNodes;
@@ -474,19 +474,10 @@ namespace pfasst
         }*/
 	
 	
-        Dune::MatrixAdapter<MatrixType,VectorType,VectorType> linearOperator(M_dtA_dune);
-
-        Dune::SeqILU0<MatrixType,VectorType,VectorType> preconditioner(M_dtA_dune,1.0);
-
-        Dune::CGSolver<VectorType> cg(linearOperator,
-                              preconditioner,
-                              1e-10, // desired residual reduction factor
-                              5000,    // maximum number of iterations
-                              0);    // verbosity of the solver
-
-        Dune::InverseOperatorResult statistics ;
-
-        cg.apply(u->data(), M_rhs_dune , statistics ); //rhs ist nicht constant!!!!!!!!!
+        // M + dt*nu*A is assembled and factorized once per distinct dt
+        this->_impl_operators.solve(this->M_dune, this->A_dune, dt * this->_nu, u->data(), M_rhs_dune,
+                                    1e-10,  // desired residual reduction factor
+                                    5000);  // maximum number of iterations
 
 
 